@@ -0,0 +1,67 @@
+//! Criterion benchmarks for the FFI hot paths, to track regressions across giac versions.
+//! Run with `cargo bench`.
+
+use criterion::{black_box, criterion_group, criterion_main, Criterion};
+use giacrs::{context::Context, gen::Gen};
+
+fn bench_from_str(c: &mut Criterion) {
+    let ctx = Context::new();
+    c.bench_function("gen_from_str", |b| {
+        b.iter(|| Gen::from_str(black_box("x^2+3*x+1"), &ctx).unwrap())
+    });
+}
+
+fn bench_operators(c: &mut Criterion) {
+    let x = Gen::from(123456);
+    c.bench_function("gen_add_assign_100", |b| {
+        b.iter(|| {
+            let mut acc = Gen::from(0);
+            for _ in 0..100 {
+                acc += &x;
+            }
+            acc
+        })
+    });
+    let a = Gen::from(7);
+    let b_ = Gen::from(9);
+    c.bench_function("gen_add_mul_100", |b| {
+        b.iter(|| {
+            let mut acc = Gen::from(0);
+            for _ in 0..100 {
+                acc.add_mul(&a, &b_);
+            }
+            acc
+        })
+    });
+}
+
+fn bench_gcd(c: &mut Criterion) {
+    let ctx = Context::new();
+    let a = Gen::from(1071);
+    let b_ = Gen::from(462);
+    c.bench_function("gen_gcd", |b| b.iter(|| a.gcd(&b_, &ctx).unwrap()));
+}
+
+fn bench_ifactors(c: &mut Criterion) {
+    let ctx = Context::new();
+    let n = Gen::from(123456789);
+    c.bench_function("gen_ifactors", |b| b.iter(|| n.ifactors(&ctx).unwrap()));
+}
+
+fn bench_det(c: &mut Criterion) {
+    let ctx = Context::new();
+    let n = 20;
+    let values: Vec<f64> = (0..n * n).map(|i| ((i * 31 + 7) % 17) as f64).collect();
+    let mat = Gen::matrix_from_doubles(&values, n, n);
+    c.bench_function("gen_det_20x20", |b| b.iter(|| mat.det(&ctx).unwrap()));
+}
+
+criterion_group!(
+    benches,
+    bench_from_str,
+    bench_operators,
+    bench_gcd,
+    bench_ifactors,
+    bench_det
+);
+criterion_main!(benches);
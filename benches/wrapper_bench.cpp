@@ -0,0 +1,73 @@
+// Microbenchmarks for the wrapper entry points in isolation, so FFI overhead
+// can be separated from giac compute time (the criterion benches in ffi.rs
+// measure both together). Not built by build.rs; compile manually with:
+//
+//   c++ -O2 benches/wrapper_bench.cpp wrapper/*.cpp -lgiac -o wrapper_bench
+
+#include <chrono>
+#include <cstdio>
+#include <giac/config.h>
+#include <giac/giac.h>
+#include <giac/global.h>
+
+typedef const char *result;
+
+extern "C" giac::gen *giacrs_gen_allocate();
+extern "C" void giacrs_free_gen(giac::gen *e);
+extern "C" giac::gen *giacrs_gen_from_int(int i);
+extern "C" result giacrs_gen_from_str(char *s, const giac::context *ctx,
+                                      giac::gen *res);
+extern "C" result giacrs_gen_add_inplace(giac::gen *res, giac::gen *f);
+extern "C" result giacrs_gen_gcd(giac::gen *a, giac::gen *b, giac::gen *res,
+                                 const giac::context *ctx);
+extern "C" result giacrs_gen_ifactors(giac::gen *e, giac::gen *res,
+                                      const giac::context *ctx);
+extern "C" result giacrs_gen_det(giac::gen *e, giac::gen *res,
+                                 const giac::context *ctx);
+extern "C" const giac::context *giacrs_new_context();
+
+template <class F>
+static void bench(const char *name, int iters, F f) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < iters; i++) {
+        f();
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    double ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+    std::printf("%-24s %12.1f ns/iter\n", name, ns / iters);
+}
+
+int main() {
+    const giac::context *ctx = giacrs_new_context();
+
+    bench("allocate+free", 1000000, [&]() {
+        giacrs_free_gen(giacrs_gen_allocate());
+    });
+
+    bench("from_int+free", 1000000, [&]() {
+        giacrs_free_gen(giacrs_gen_from_int(42));
+    });
+
+    giac::gen res;
+    char expr[] = "x^2+3*x+1";
+    bench("from_str", 100000, [&]() {
+        giacrs_gen_from_str(expr, ctx, &res);
+    });
+
+    giac::gen acc(0), x(123456);
+    bench("add_inplace", 1000000, [&]() { giacrs_gen_add_inplace(&acc, &x); });
+
+    giac::gen a(1071), b(462);
+    bench("gcd", 100000, [&]() { giacrs_gen_gcd(&a, &b, &res, ctx); });
+
+    giac::gen n(123456789);
+    bench("ifactors", 10000, [&]() { giacrs_gen_ifactors(&n, &res, ctx); });
+
+    giac::gen mat;
+    char matstr[] = "[[1,2,3],[4,5,6],[7,8,10]]";
+    giacrs_gen_from_str(matstr, ctx, &mat);
+    bench("det_3x3", 100000, [&]() { giacrs_gen_det(&mat, &res, ctx); });
+
+    return 0;
+}
@@ -0,0 +1,110 @@
+//! Arena allocation for [Gen] objects
+//!
+//! Creating short-lived gens in tight loops pays a malloc per gen and a `free` FFI call per drop.
+//! An [Arena] allocates gens out of fixed-size blocks on the cpp side and frees them all in one
+//! call when it is dropped, so allocation becomes a pointer bump.
+//! The per-gen functions ([Gen::new], [Gen::from], ...) are kept as the fallback path.
+
+use std::{ffi::CString, marker::PhantomData, mem::ManuallyDrop, ops::Deref};
+
+use crate::{context::Context, ffi, gen::Gen, GiacError};
+
+pub(crate) enum GiacArena {}
+pub(crate) type GiacArenaRef = *mut GiacArena;
+
+/// An arena of giac gens. All gens allocated from it are freed in a single call when the arena
+/// goes out of scope.
+/// ```
+/// use giacrs::arena::Arena;
+/// use giacrs::context::Context;
+///
+/// let ctx = Context::new();
+/// let arena = Arena::new();
+///
+/// let a = arena.from_int(18);
+/// let b = arena.from_int(12);
+///
+/// assert_eq!(6, a.gcd(&b, &ctx)?.to_int()?);
+/// // every gen allocated from `arena` is freed here, in one FFI call
+/// # use giacrs::GiacError;
+/// # Ok::<(), GiacError>(())
+/// ```
+pub struct Arena(GiacArenaRef);
+
+/// A [Gen] allocated from an [Arena]. It dereferences to [Gen] so all its methods are available,
+/// but dropping it is a no-op: the backing gen is owned by the arena.
+pub struct ArenaGen<'a> {
+    gen: ManuallyDrop<Gen>,
+    _arena: PhantomData<&'a Arena>,
+}
+
+impl Deref for ArenaGen<'_> {
+    type Target = Gen;
+
+    fn deref(&self) -> &Self::Target {
+        &self.gen
+    }
+}
+
+impl Arena {
+    /// Create a new empty arena
+    pub fn new() -> Self {
+        Self(unsafe { ffi::giacrs_arena_new() })
+    }
+
+    fn wrap(&self, gen: crate::gen::GiacGenRef) -> ArenaGen<'_> {
+        ArenaGen {
+            gen: ManuallyDrop::new(Gen(gen)),
+            _arena: PhantomData,
+        }
+    }
+
+    /// Allocate a new empty gen from the arena
+    pub fn alloc(&self) -> ArenaGen<'_> {
+        self.wrap(unsafe { ffi::giacrs_arena_allocate(self.0) })
+    }
+
+    /// Allocate a gen holding an integer from the arena
+    /// ```
+    /// use giacrs::arena::Arena;
+    ///
+    /// let arena = Arena::new();
+    /// assert_eq!(42, arena.from_int(42).to_int()?);
+    /// # use giacrs::GiacError;
+    /// # Ok::<(), GiacError>(())
+    /// ```
+    pub fn from_int(&self, i: i32) -> ArenaGen<'_> {
+        self.wrap(unsafe { ffi::giacrs_arena_from_int(self.0, i) })
+    }
+
+    /// Parse and evaluate a string into an arena-allocated gen. See [Gen::from_str]
+    /// ```
+    /// use giacrs::arena::Arena;
+    /// use giacrs::context::Context;
+    ///
+    /// let ctx = Context::new();
+    /// let arena = Arena::new();
+    ///
+    /// assert_eq!(12, arena.from_str("3*4", &ctx)?.to_int()?);
+    /// # use giacrs::GiacError;
+    /// # Ok::<(), GiacError>(())
+    /// ```
+    pub fn from_str<'a>(&'a self, str: &str, ctx: &Context) -> Result<ArenaGen<'a>, GiacError> {
+        let s = CString::new(str).unwrap();
+        let gen = self.alloc();
+        let error = unsafe {
+            ffi::giacrs_gen_from_str(s.as_ptr(), ctx.as_context_ref(), gen.as_gen_ref())
+        };
+        if error == std::ptr::null() {
+            Ok(gen)
+        } else {
+            Err(GiacError::InternalError(error.into()))
+        }
+    }
+}
+
+impl Drop for Arena {
+    fn drop(&mut self) {
+        unsafe { ffi::giacrs_arena_free(self.0) };
+    }
+}
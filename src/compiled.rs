@@ -0,0 +1,83 @@
+//! Compiled expressions: parse a formula once, evaluate it many times
+//!
+//! Evaluating the same symbolic formula with many different bindings through [Gen::from_str]
+//! pays a full parse plus evaluation per binding. A [CompiledExpr] is parsed a single time;
+//! every [CompiledExpr::call] only substitutes the parameter slots and evaluates.
+
+use std::ffi::CString;
+
+use crate::{context::Context, ffi, gen::Gen, GiacError};
+
+pub(crate) enum GiacCompiled {}
+pub(crate) type GiacCompiledRef = *mut GiacCompiled;
+
+/// A parsed expression template with named parameter slots.
+/// ```
+/// use giacrs::compiled::CompiledExpr;
+/// use giacrs::context::Context;
+///
+/// let ctx = Context::new();
+/// // Parsed once, whatever the number of calls
+/// let f = CompiledExpr::new("x^2+y", &["x", "y"], &ctx)?;
+///
+/// assert_eq!(7, f.call(&[2.into(), 3.into()], &ctx)?.to_int()?);
+/// assert_eq!(19, f.call(&[4.into(), 3.into()], &ctx)?.to_int()?);
+/// # use giacrs::GiacError;
+/// # Ok::<(), GiacError>(())
+/// ```
+pub struct CompiledExpr(GiacCompiledRef);
+
+impl CompiledExpr {
+    /// Parses `expr` once and declares `params` as its parameter slots
+    pub fn new(expr: &str, params: &[&str], ctx: &Context) -> Result<Self, GiacError> {
+        let s = CString::new(expr).unwrap();
+        let cparams: Vec<CString> = params
+            .iter()
+            .map(|p| CString::new(*p).unwrap())
+            .collect();
+        let ptrs: Vec<*const std::os::raw::c_char> =
+            cparams.iter().map(|p| p.as_ptr()).collect();
+        let mut out: GiacCompiledRef = std::ptr::null_mut();
+        let error = unsafe {
+            ffi::giacrs_compiled_new(
+                s.as_ptr(),
+                ptrs.as_ptr(),
+                params.len(),
+                &mut out,
+                ctx.as_context_ref(),
+            )
+        };
+        if error == std::ptr::null() {
+            Ok(Self(out))
+        } else {
+            Err(GiacError::InternalError(error.into()))
+        }
+    }
+
+    /// Substitutes `args` into the parameter slots and evaluates, skipping the parser entirely.
+    /// `args` must have one element per declared parameter.
+    pub fn call(&self, args: &[Gen], ctx: &Context) -> Result<Gen, GiacError> {
+        let inputs: Vec<_> = args.iter().map(|e| unsafe { e.as_gen_ref() }).collect();
+        let result = Gen::new();
+        let error = unsafe {
+            ffi::giacrs_compiled_call(
+                self.0,
+                inputs.as_ptr(),
+                args.len(),
+                result.as_gen_ref(),
+                ctx.as_context_ref(),
+            )
+        };
+        if error == std::ptr::null() {
+            Ok(result)
+        } else {
+            Err(GiacError::InternalError(error.into()))
+        }
+    }
+}
+
+impl Drop for CompiledExpr {
+    fn drop(&mut self) {
+        unsafe { ffi::giacrs_compiled_free(self.0) };
+    }
+}
@@ -1,10 +1,15 @@
 //! A giac `Context` to keep variables
 
-use std::sync::LazyLock;
+use std::{
+    ffi::{c_char, CString},
+    mem::ManuallyDrop,
+    ops::{Deref, DerefMut},
+    sync::LazyLock,
+};
 
 use crate::{
-    ffi::{self, giacrs_init_global_context},
-    gen::Gen,
+    ffi,
+    gen::{Gen, GiacGenRef},
     support::GiacError,
 };
 
@@ -17,12 +22,11 @@ pub struct Context(GiacContextRef);
 unsafe impl Sync for Context {}
 unsafe impl Send for Context {}
 
-/// Pointer to the global giac context
+/// Pointer to the global giac context. It is fetched lazily: a process that never touches it
+/// skips the initialization cost entirely, see [warmup] for the opposite trade-off.
 #[allow(unused)]
-pub static GLOBAL_CONTEXT: LazyLock<Context> = LazyLock::new(|| {
-    unsafe { giacrs_init_global_context() };
-    Context(unsafe { ffi::giacrs_global_context })
-});
+pub static GLOBAL_CONTEXT: LazyLock<Context> =
+    LazyLock::new(|| Context(unsafe { ffi::giacrs_get_global_context() }));
 
 impl Context {
     /// Internal giac pointer
@@ -52,6 +56,138 @@ impl Context {
     pub fn eval(&self, str: &str) -> Result<Gen, GiacError> {
         Gen::from_str(str, &self)
     }
+
+    /// Parses many expressions (newline- or semicolon-separated, empty segments skipped) in a
+    /// single FFI call against this context. With `eval` set to `false` only the parse trees
+    /// are built, which is enough for loading a worksheet and much faster. Each expression
+    /// gets its own result, so one bad line doesn't abort the rest.
+    /// ```
+    /// use giacrs::context::Context;
+    ///
+    /// let ctx = Context::new();
+    /// let mut results = ctx.eval_multi("a:=3; a*2\na+1", true).into_iter();
+    ///
+    /// assert_eq!(3, results.next().unwrap()?.to_int()?);
+    /// assert_eq!(6, results.next().unwrap()?.to_int()?);
+    /// assert_eq!(4, results.next().unwrap()?.to_int()?);
+    /// # use giacrs::GiacError;
+    /// # Ok::<(), GiacError>(())
+    /// ```
+    pub fn eval_multi(&self, src: &str, eval: bool) -> Vec<Result<Gen, GiacError>> {
+        let srcs: Vec<CString> = src
+            .split(['\n', ';'])
+            .map(str::trim)
+            .filter(|s| !s.is_empty())
+            .map(|s| CString::new(s).unwrap())
+            .collect();
+        let ptrs: Vec<*const c_char> = srcs.iter().map(|s| s.as_ptr()).collect();
+        let results: Vec<Gen> = srcs.iter().map(|_| Gen::new()).collect();
+        let outputs: Vec<GiacGenRef> = results.iter().map(|e| unsafe { e.as_gen_ref() }).collect();
+        let mut statuses: Vec<ffi::GiacResult> = vec![std::ptr::null(); srcs.len()];
+        unsafe {
+            ffi::giacrs_gen_from_str_multi(
+                ptrs.as_ptr(),
+                ptrs.len(),
+                outputs.as_ptr(),
+                statuses.as_mut_ptr(),
+                eval,
+                self.as_context_ref(),
+            )
+        };
+        results
+            .into_iter()
+            .zip(statuses)
+            .map(|(gen, error)| {
+                if error == std::ptr::null() {
+                    Ok(gen)
+                } else {
+                    Err(GiacError::InternalError(error.into()))
+                }
+            })
+            .collect()
+    }
+
+    /// Checks out a context from the internal pool, creating one only if the pool is empty.
+    /// Constructing a giac context is slow; for per-session isolation, checking out a pooled
+    /// context and letting it return to the pool on drop is much cheaper than [Context::new].
+    /// ```
+    /// use giacrs::context::Context;
+    ///
+    /// let ctx = Context::checkout();
+    /// assert_eq!(4, ctx.eval("2+2")?.to_int()?);
+    /// // `ctx` returns to the pool here, with its user variables cleared
+    /// # use giacrs::GiacError;
+    /// # Ok::<(), GiacError>(())
+    /// ```
+    pub fn checkout() -> PooledContext {
+        PooledContext(ManuallyDrop::new(Context(unsafe {
+            ffi::giacrs_context_checkout()
+        })))
+    }
+
+    /// Clears the user variables of the context without reconstructing it, and restores the
+    /// session options ([Context::set_epsilon], [Context::set_proba_epsilon]) to their
+    /// defaults.
+    /// ```
+    /// use giacrs::context::Context;
+    ///
+    /// let mut ctx = Context::new();
+    /// ctx.eval("a:=5")?;
+    /// assert_eq!(5, ctx.eval("a")?.to_int()?);
+    ///
+    /// ctx.reset();
+    /// // `a` is a free symbol again
+    /// assert_eq!("a", ctx.eval("a")?.to_string());
+    /// # use giacrs::GiacError;
+    /// # Ok::<(), GiacError>(())
+    /// ```
+    pub fn reset(&mut self) {
+        unsafe { ffi::giacrs_context_reset(self.as_context_ref()) };
+    }
+}
+
+/// Eagerly initializes the global context and forces giac's lazily-built parser and
+/// evaluation tables through a trivial round trip. Short-lived processes should skip this
+/// and let initialization happen on first use; long-lived services can call it at startup
+/// so their first request doesn't pay the first-eval cost.
+/// ```
+/// use giacrs::context;
+///
+/// context::warmup();
+/// ```
+pub fn warmup() {
+    unsafe { ffi::giacrs_warmup() };
+}
+
+/// Preallocate `n` contexts in the internal pool, so the first `n` calls to [Context::checkout]
+/// never pay a context construction.
+pub fn reserve_contexts(n: usize) {
+    unsafe { ffi::giacrs_context_pool_reserve(n) };
+}
+
+/// A [Context] checked out from the internal pool. It dereferences to [Context]; dropping it
+/// returns it to the pool instead of destroying it, after a [Context::reset] so neither user
+/// variables nor mutated session options leak into the next checkout.
+pub struct PooledContext(ManuallyDrop<Context>);
+
+impl Deref for PooledContext {
+    type Target = Context;
+
+    fn deref(&self) -> &Self::Target {
+        &self.0
+    }
+}
+
+impl DerefMut for PooledContext {
+    fn deref_mut(&mut self) -> &mut Self::Target {
+        &mut self.0
+    }
+}
+
+impl Drop for PooledContext {
+    fn drop(&mut self) {
+        unsafe { ffi::giacrs_context_release(self.as_context_ref()) };
+    }
 }
 
 impl Drop for Context {
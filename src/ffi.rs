@@ -2,15 +2,21 @@
 //! All these functions start with `giacrs_` to avoid conflict with giac names on the cpp side.
 
 use crate::{
+    arena::GiacArenaRef,
+    compiled::GiacCompiledRef,
     context::GiacContextRef,
     gen::GiacGenRef,
     types::GenType,
 };
 
 pub type GiacResult = *const std::os::raw::c_char;
+/// 0 on success; on failure the message is in a thread-local slot on the cpp side,
+/// fetched lazily with [giacrs_last_error_copy]
+pub type GiacErrCode = i32;
 
 extern "C" {
     pub fn giacrs_free_str(str: *const std::os::raw::c_char);
+    pub fn giacrs_last_error_copy() -> *const std::os::raw::c_char;
 
     pub fn giacrs_gen_allocate() -> GiacGenRef;
     pub fn giacrs_gen_from_str(
@@ -18,22 +24,152 @@ extern "C" {
         ctx: GiacContextRef,
         expr: GiacGenRef,
     ) -> GiacResult;
+    pub fn giacrs_gen_from_str_code(
+        str: *const std::os::raw::c_char,
+        ctx: GiacContextRef,
+        expr: GiacGenRef,
+    ) -> GiacErrCode;
+
+    pub fn giacrs_gen_from_str_multi(
+        srcs: *const *const std::os::raw::c_char,
+        len: usize,
+        res: *const GiacGenRef,
+        statuses: *mut GiacResult,
+        do_eval: bool,
+        ctx: GiacContextRef,
+    );
+
+    pub fn giacrs_gen_eval_batch(
+        exprs: *const GiacGenRef,
+        res: *const GiacGenRef,
+        statuses: *mut GiacResult,
+        len: usize,
+        ctx: GiacContextRef,
+    );
 
     pub fn giacrs_gen_from_int(i: std::os::raw::c_int) -> GiacGenRef;
     pub fn giacrs_gen_from_float(i: std::os::raw::c_float) -> GiacGenRef;
     pub fn giacrs_gen_from_double(i: std::os::raw::c_double) -> GiacGenRef;
     pub fn giacrs_gen_factorial(i: std::os::raw::c_ulong) -> GiacGenRef;
     pub fn giacrs_free_gen(expr: GiacGenRef);
+    pub fn giacrs_free_gen_batch(exprs: *const GiacGenRef, len: usize);
 
     pub fn giacrs_gen_clone(expr: GiacGenRef) -> GiacGenRef;
+    pub fn giacrs_gen_deep_copy(expr: GiacGenRef) -> GiacGenRef;
+
+    pub fn giacrs_gen_byte_size(expr: GiacGenRef, res: *mut usize) -> GiacResult;
+    pub fn giacrs_gen_to_bytes(expr: GiacGenRef, out: *mut u8, sign: *mut i8) -> GiacResult;
+    pub fn giacrs_gen_from_bytes(data: *const u8, len: usize, sign: i8) -> GiacGenRef;
+
+    pub fn giacrs_gen_ident(name: *const std::os::raw::c_char) -> GiacGenRef;
+    pub fn giacrs_gen_apply(
+        f: GiacGenRef,
+        args: *const GiacGenRef,
+        len: usize,
+        res: GiacGenRef,
+    ) -> GiacResult;
+
+    // COMPILED EXPRESSIONS
+    pub fn giacrs_compiled_new(
+        str: *const std::os::raw::c_char,
+        params: *const *const std::os::raw::c_char,
+        nparams: usize,
+        out: *mut GiacCompiledRef,
+        ctx: GiacContextRef,
+    ) -> GiacResult;
+    pub fn giacrs_compiled_call(
+        compiled: GiacCompiledRef,
+        args: *const GiacGenRef,
+        nargs: usize,
+        res: GiacGenRef,
+        ctx: GiacContextRef,
+    ) -> GiacResult;
+    pub fn giacrs_compiled_free(compiled: GiacCompiledRef);
+
+    // VECTEUR
+    pub fn giacrs_gen_vecteur_from_doubles(data: *const f64, len: usize) -> GiacGenRef;
+    pub fn giacrs_gen_vecteur_from_ints(data: *const i64, len: usize) -> GiacGenRef;
+    pub fn giacrs_gen_matrix_from_doubles(data: *const f64, rows: usize, cols: usize)
+        -> GiacGenRef;
+    pub fn giacrs_gen_vecteur_len(expr: GiacGenRef, res: *mut usize) -> GiacResult;
+    pub fn giacrs_gen_vecteur_to_doubles(
+        expr: GiacGenRef,
+        out: *mut f64,
+        len: usize,
+    ) -> GiacResult;
+
+    // NUMERIC
+    pub fn giacrs_dmat_det(data: *const f64, n: usize, res: *mut f64) -> GiacResult;
+    pub fn giacrs_dmat_lu_solve(
+        data: *const f64,
+        b: *const f64,
+        n: usize,
+        nrhs: usize,
+        x: *mut f64,
+    ) -> GiacResult;
+    pub fn giacrs_dmat_mul(
+        a: *const f64,
+        b: *const f64,
+        c: *mut f64,
+        m: usize,
+        k: usize,
+        n: usize,
+    );
+    pub fn giacrs_dmat_rank(data: *const f64, rows: usize, cols: usize) -> usize;
+
+    // ARENA
+    pub fn giacrs_arena_new() -> GiacArenaRef;
+    pub fn giacrs_arena_allocate(arena: GiacArenaRef) -> GiacGenRef;
+    pub fn giacrs_arena_from_int(arena: GiacArenaRef, i: std::os::raw::c_int) -> GiacGenRef;
+    pub fn giacrs_arena_free(arena: GiacArenaRef);
 
     // DATA
     pub fn giacrs_gen_type(expr: GiacGenRef) -> GenType;
     pub fn giacrs_gen_is_zero(expr: GiacGenRef, res: *mut bool, ctx: GiacContextRef) -> GiacResult;
+    pub fn giacrs_gen_to_int_unchecked(expr: GiacGenRef) -> std::os::raw::c_int;
+    pub fn giacrs_gen_is_zero_unchecked(expr: GiacGenRef) -> bool;
+    pub fn giacrs_gen_even_unchecked(expr: GiacGenRef) -> bool;
+    pub fn giacrs_gen_sign_unchecked(expr: GiacGenRef) -> i8;
+    pub fn giacrs_gen_is_integer(expr: GiacGenRef) -> bool;
     // CONVERSION
     pub fn giacrs_gen_to_str(expr: GiacGenRef) -> *const std::os::raw::c_char;
+    pub fn giacrs_gen_print_with(
+        expr: GiacGenRef,
+        writer: unsafe extern "C" fn(*mut std::os::raw::c_void, *const std::os::raw::c_char, usize),
+        data: *mut std::os::raw::c_void,
+    );
+    pub fn giacrs_gen_print_chunked(
+        expr: GiacGenRef,
+        chunk_size: usize,
+        writer: unsafe extern "C" fn(*mut std::os::raw::c_void, *const std::os::raw::c_char, usize),
+        data: *mut std::os::raw::c_void,
+    );
     pub fn giacrs_gen_to_int(expr: GiacGenRef, res: *mut std::os::raw::c_int) -> GiacResult;
 
+    // INTERRUPTION
+    pub fn giacrs_interrupt();
+    pub fn giacrs_gen_eval_timeout(
+        expr: GiacGenRef,
+        res: GiacGenRef,
+        seconds: f64,
+        interrupted: *mut bool,
+        ctx: GiacContextRef,
+    ) -> GiacResult;
+
+    // SERIALIZATION
+    pub fn giacrs_gen_archive(
+        expr: GiacGenRef,
+        buf: *mut *const std::os::raw::c_char,
+        len: *mut usize,
+        ctx: GiacContextRef,
+    ) -> GiacResult;
+    pub fn giacrs_gen_unarchive(
+        buf: *const std::os::raw::c_char,
+        len: usize,
+        res: GiacGenRef,
+        ctx: GiacContextRef,
+    ) -> GiacResult;
+
     // METHODS
     pub fn giacrs_gen_gcd(
         a: GiacGenRef,
@@ -42,6 +178,13 @@ extern "C" {
         ctx: GiacContextRef,
     ) -> GiacResult;
     pub fn giacrs_gen_lcm(a: GiacGenRef, b: GiacGenRef, res: GiacGenRef) -> GiacResult;
+    pub fn giacrs_gen_gcd_n(
+        exprs: *const GiacGenRef,
+        len: usize,
+        res: GiacGenRef,
+        ctx: GiacContextRef,
+    ) -> GiacResult;
+    pub fn giacrs_gen_lcm_n(exprs: *const GiacGenRef, len: usize, res: GiacGenRef) -> GiacResult;
     pub fn giacrs_gen_ifactor(expr: GiacGenRef, res: GiacGenRef, ctx: GiacContextRef)
         -> GiacResult;
     pub fn giacrs_gen_ifactors(
@@ -59,6 +202,13 @@ extern "C" {
         res: GiacGenRef,
         ctx: GiacContextRef,
     ) -> GiacResult;
+    pub fn giacrs_gen_ifactors_batch(
+        exprs: *const GiacGenRef,
+        res: *const GiacGenRef,
+        statuses: *mut GiacResult,
+        len: usize,
+        threads: usize,
+    );
     pub fn giacrs_gen_iquo(a: GiacGenRef, b: GiacGenRef, res: GiacGenRef) -> GiacResult;
     pub fn giacrs_gen_irem(a: GiacGenRef, b: GiacGenRef, res: GiacGenRef) -> GiacResult;
     pub fn giacrs_gen_iquorem(
@@ -67,9 +217,44 @@ extern "C" {
         res: GiacGenRef,
         r: GiacGenRef,
     ) -> GiacResult;
+    pub fn giacrs_gen_irem_batch(
+        exprs: *const GiacGenRef,
+        len: usize,
+        modulus: GiacGenRef,
+    ) -> GiacResult;
     pub fn giacrs_gen_even(expr: GiacGenRef, res: *mut bool, ctx: GiacContextRef) -> GiacResult;
     pub fn giacrs_gen_odd(expr: GiacGenRef, res: *mut bool, ctx: GiacContextRef) -> GiacResult;
     pub fn giacrs_gen_is_pseudoprime(expr: GiacGenRef, res: *mut u8) -> GiacResult;
+    pub fn giacrs_prime_sieve(lo: u64, hi: u64, out: *mut u8);
+    pub fn giacrs_gen_is_zero_batch(
+        exprs: *const GiacGenRef,
+        len: usize,
+        out: *mut u8,
+        ctx: GiacContextRef,
+    ) -> GiacResult;
+    pub fn giacrs_gen_even_batch(
+        exprs: *const GiacGenRef,
+        len: usize,
+        out: *mut u8,
+        ctx: GiacContextRef,
+    ) -> GiacResult;
+    pub fn giacrs_gen_odd_batch(
+        exprs: *const GiacGenRef,
+        len: usize,
+        out: *mut u8,
+        ctx: GiacContextRef,
+    ) -> GiacResult;
+    pub fn giacrs_gen_sign_batch(
+        exprs: *const GiacGenRef,
+        len: usize,
+        out: *mut i8,
+        ctx: GiacContextRef,
+    ) -> GiacResult;
+    pub fn giacrs_gen_is_pseudoprime_batch(
+        exprs: *const GiacGenRef,
+        len: usize,
+        out: *mut i8,
+    ) -> GiacResult;
     pub fn giacrs_gen_nextprime(expr: GiacGenRef, res: GiacGenRef) -> GiacResult;
     pub fn giacrs_gen_prevprime(expr: GiacGenRef, res: GiacGenRef) -> GiacResult;
     pub fn giacrs_gen_nthprime(
@@ -129,22 +314,44 @@ extern "C" {
 
     // OPERATOR
 
-    pub fn giacrs_gen_add(left: GiacGenRef, right: GiacGenRef) -> GiacResult;
-    pub fn giacrs_gen_sub(left: GiacGenRef, right: GiacGenRef) -> GiacResult;
-    pub fn giacrs_gen_mul(left: GiacGenRef, right: GiacGenRef) -> GiacResult;
     pub fn giacrs_gen_div(left: GiacGenRef, right: GiacGenRef) -> GiacResult;
+
+    pub fn giacrs_gen_add_inplace(left: GiacGenRef, right: GiacGenRef) -> GiacResult;
+    pub fn giacrs_gen_sub_inplace(left: GiacGenRef, right: GiacGenRef) -> GiacResult;
+    pub fn giacrs_gen_mul_inplace(left: GiacGenRef, right: GiacGenRef) -> GiacResult;
+    pub fn giacrs_gen_fma(acc: GiacGenRef, a: GiacGenRef, b: GiacGenRef) -> GiacResult;
+}
+
+extern "C" {
+    pub fn giacrs_memo_enable(capacity: usize);
+    pub fn giacrs_memo_disable();
 }
 
 extern "C" {
     pub fn giacrs_options_set_epsilon(epsilon: std::os::raw::c_double, ctx: GiacContextRef);
+    pub fn giacrs_options_set_threads(n: std::os::raw::c_int);
+    pub fn giacrs_options_threads() -> std::os::raw::c_int;
+    pub fn giacrs_options_set_proba_epsilon(epsilon: std::os::raw::c_double, ctx: GiacContextRef);
+    pub fn giacrs_options_proba_epsilon(ctx: GiacContextRef) -> std::os::raw::c_double;
+    pub fn giacrs_options_set_max_recursion(n: std::os::raw::c_int);
+    pub fn giacrs_options_max_recursion() -> std::os::raw::c_int;
 }
 
 extern "C" {
-    pub static giacrs_global_context: GiacContextRef;
-    pub fn giacrs_init_global_context();
+    pub fn giacrs_stats_snapshot(out: *mut crate::stats::GiacStats);
+}
+
+extern "C" {
+    pub fn giacrs_get_global_context() -> GiacContextRef;
+    pub fn giacrs_warmup();
     pub fn giacrs_new_context() -> GiacContextRef;
     pub fn giacrs_free_context(ctx: GiacContextRef);
 
+    pub fn giacrs_context_reset(ctx: GiacContextRef);
+    pub fn giacrs_context_checkout() -> GiacContextRef;
+    pub fn giacrs_context_release(ctx: GiacContextRef);
+    pub fn giacrs_context_pool_reserve(n: usize);
+
     pub fn giacrs_release_globals();
 
     pub fn giacrs_gen_factor(expr: GiacGenRef, res: GiacGenRef, ctx: GiacContextRef) -> GiacResult;
@@ -19,6 +19,11 @@ pub(crate) type GiacGenRef = *mut GiacGen;
 #[derive(Debug)]
 pub struct Gen(pub(crate) GiacGenRef);
 
+// Gen is deliberately neither Send nor Sync: giac reference-counts the heavy payloads
+// with plain non-atomic ints, and clones share those payloads, so a Gen moved to another
+// thread could race with a clone dropped on this one. [crate::parallel] moves expressions
+// across threads by deep-copying them at the boundary instead.
+
 impl Gen {
     /// Create a new empty `Gen` object
     pub fn new() -> Self {
@@ -45,7 +50,98 @@ impl Gen {
     /// <https://www-fourier.ujf-grenoble.fr/~parisse/giac/doc/en/cascmd_en/node29.html>
     pub fn from_str(str: &str, ctx: &Context) -> Result<Self, GiacError> {
         let s = CString::new(str).unwrap();
-        ffi_safe_call! { ffi::giacrs_gen_from_str(s.as_ptr(), ctx.as_context_ref(), result.as_gen_ref()) }
+        let result = Self(unsafe { ffi::giacrs_gen_allocate() });
+        // Errcode convention: nothing is allocated for the error message
+        // unless the call actually fails
+        let code = unsafe {
+            ffi::giacrs_gen_from_str_code(s.as_ptr(), ctx.as_context_ref(), result.as_gen_ref())
+        };
+        if code == 0 {
+            Ok(result)
+        } else {
+            Err(GiacError::InternalError(
+                unsafe { ffi::giacrs_last_error_copy() }.into(),
+            ))
+        }
+    }
+
+    /// Evaluates several expressions against one context in a single FFI call.
+    /// Each element gets its own status, so one failing expression doesn't abort the others.
+    /// This amortizes the FFI transition and exception-handling cost over the whole batch,
+    /// which is much faster than evaluating thousands of small expressions one by one.
+    /// ```
+    /// use giacrs::context::Context;
+    /// use giacrs::gen::Gen;
+    ///
+    /// let ctx = Context::new();
+    /// let exprs = vec![ctx.eval("2+2")?, ctx.eval("3*3")?];
+    ///
+    /// let mut results = Gen::eval_batch(&exprs, &ctx).into_iter();
+    /// assert_eq!(4, results.next().unwrap()?.to_int()?);
+    /// assert_eq!(9, results.next().unwrap()?.to_int()?);
+    /// # use giacrs::GiacError;
+    /// # Ok::<(), GiacError>(())
+    /// ```
+    pub fn eval_batch(exprs: &[Gen], ctx: &Context) -> Vec<Result<Gen, GiacError>> {
+        let inputs: Vec<GiacGenRef> = exprs.iter().map(|e| unsafe { e.as_gen_ref() }).collect();
+        let results: Vec<Gen> = exprs.iter().map(|_| Gen::new()).collect();
+        let outputs: Vec<GiacGenRef> = results.iter().map(|e| unsafe { e.as_gen_ref() }).collect();
+        let mut statuses: Vec<ffi::GiacResult> = vec![std::ptr::null(); exprs.len()];
+        unsafe {
+            ffi::giacrs_gen_eval_batch(
+                inputs.as_ptr(),
+                outputs.as_ptr(),
+                statuses.as_mut_ptr(),
+                exprs.len(),
+                ctx.as_context_ref(),
+            )
+        };
+        results
+            .into_iter()
+            .zip(statuses)
+            .map(|(gen, error)| {
+                if error == std::ptr::null() {
+                    Ok(gen)
+                } else {
+                    Err(GiacError::InternalError(error.into()))
+                }
+            })
+            .collect()
+    }
+
+    /// Creates a symbolic identifier directly from its name, without running the parser and
+    /// evaluator like [Gen::from_str] does. giac compares identifiers by name and binds them
+    /// through the context, so identifiers created separately with the same name are fully
+    /// interchangeable.
+    /// ```
+    /// use giacrs::gen::Gen;
+    ///
+    /// let x = Gen::ident("x");
+    /// assert_eq!("x", x.to_string());
+    /// ```
+    pub fn ident(name: &str) -> Self {
+        let s = CString::new(name).unwrap();
+        Self(unsafe { ffi::giacrs_gen_ident(s.as_ptr()) })
+    }
+
+    /// Builds the symbolic application `self(args...)` as an expression tree, without
+    /// evaluating it and without the parser. Combined with [Gen::ident] this assembles
+    /// expressions fully programmatically; evaluate the result later with [Gen::eval_batch]
+    /// or [crate::context::Context::eval].
+    /// ```
+    /// use giacrs::context::Context;
+    /// use giacrs::gen::Gen;
+    ///
+    /// let ctx = Context::new();
+    /// let sin = ctx.eval("sin")?;
+    /// let expr = sin.apply(&[&Gen::ident("x")])?;
+    /// assert_eq!("sin(x)", expr.to_string());
+    /// # use giacrs::GiacError;
+    /// # Ok::<(), GiacError>(())
+    /// ```
+    pub fn apply(&self, args: &[&Gen]) -> Result<Self, GiacError> {
+        let refs: Vec<GiacGenRef> = args.iter().map(|a| unsafe { a.as_gen_ref() }).collect();
+        ffi_safe_call! { ffi::giacrs_gen_apply(self.as_gen_ref(), refs.as_ptr(), refs.len(), result.as_gen_ref()) }
     }
 
     /// Creates a `Gen` object from a factorial
@@ -73,6 +169,73 @@ impl Gen {
         unsafe { GiacString::new(str) }
     }
 
+    /// Appends the string representation of the expression to a rust-owned [String],
+    /// without allocating an intermediate C string like [Gen::print_to_string] does.
+    /// For big outputs (large polynomials, ...) this halves the memory churn of stringification.
+    /// ```
+    /// use giacrs::gen::Gen;
+    ///
+    /// let mut out = String::new();
+    /// Gen::from(42).print_into(&mut out);
+    /// assert_eq!("42", out);
+    /// ```
+    pub fn print_into(&self, out: &mut String) {
+        unsafe extern "C" fn writer(
+            data: *mut std::os::raw::c_void,
+            bytes: *const std::os::raw::c_char,
+            len: usize,
+        ) {
+            let out = &mut *(data as *mut String);
+            let bytes = std::slice::from_raw_parts(bytes as *const u8, len);
+            match std::str::from_utf8(bytes) {
+                Ok(s) => out.push_str(s),
+                Err(_) => out.push_str(&String::from_utf8_lossy(bytes)),
+            }
+        }
+        unsafe {
+            ffi::giacrs_gen_print_with(
+                self.as_gen_ref(),
+                writer,
+                out as *mut String as *mut std::os::raw::c_void,
+            )
+        };
+    }
+
+    /// Streams the textual form of the expression to `sink` in chunks of at most
+    /// `chunk_size` bytes, so serializing a huge expression never requires accepting
+    /// the whole output in one piece (e.g. when writing to a file or a fixed buffer).
+    /// Chunks are raw bytes: a chunk boundary can fall anywhere, including inside a
+    /// UTF-8 sequence.
+    /// ```
+    /// use giacrs::gen::Gen;
+    ///
+    /// let e = Gen::factorial(24);
+    /// let mut out = Vec::new();
+    /// e.print_chunked(8, |chunk| {
+    ///     assert!(chunk.len() <= 8);
+    ///     out.extend_from_slice(chunk);
+    /// });
+    /// assert_eq!(b"620448401733239439360000".to_vec(), out);
+    /// ```
+    pub fn print_chunked<F: FnMut(&[u8])>(&self, chunk_size: usize, mut sink: F) {
+        unsafe extern "C" fn writer<F: FnMut(&[u8])>(
+            data: *mut std::os::raw::c_void,
+            bytes: *const std::os::raw::c_char,
+            len: usize,
+        ) {
+            let sink = &mut *(data as *mut F);
+            sink(std::slice::from_raw_parts(bytes as *const u8, len));
+        }
+        unsafe {
+            ffi::giacrs_gen_print_chunked(
+                self.as_gen_ref(),
+                chunk_size,
+                writer::<F>,
+                &mut sink as *mut F as *mut std::os::raw::c_void,
+            )
+        };
+    }
+
     /// Converts an expression to a primitive integer
     /// ```
     /// use giacrs::gen::Gen;
@@ -92,6 +255,91 @@ impl Gen {
         }
     }
 
+    /// Evaluates the expression with a deadline. If evaluation is still running after
+    /// `seconds`, giac is interrupted and [GiacError::Interrupted] is returned, protecting
+    /// the caller from pathological expressions which would otherwise spin for minutes.
+    ///
+    /// giac's interruption flags are **process-wide**, so timeout-bounded evaluations are
+    /// serialized internally — concurrent `eval_timeout` calls queue up rather than abort
+    /// each other. An expiring deadline can still interrupt evaluations running *outside*
+    /// this entry point (e.g. [crate::parallel] workers), just like [crate::interrupt].
+    /// ```
+    /// use giacrs::context::Context;
+    /// use giacrs::gen::Gen;
+    ///
+    /// let ctx = Context::new();
+    /// let e = ctx.eval("2+2")?;
+    ///
+    /// assert_eq!(4, e.eval_timeout(5.0, &ctx)?.to_int()?);
+    /// # use giacrs::GiacError;
+    /// # Ok::<(), GiacError>(())
+    /// ```
+    pub fn eval_timeout(&self, seconds: f64, ctx: &Context) -> Result<Self, GiacError> {
+        let result = Self::new();
+        let mut interrupted = false;
+        let error = unsafe {
+            ffi::giacrs_gen_eval_timeout(
+                self.as_gen_ref(),
+                result.as_gen_ref(),
+                seconds,
+                &mut interrupted,
+                ctx.as_context_ref(),
+            )
+        };
+        if interrupted {
+            if error != std::ptr::null() {
+                unsafe { ffi::giacrs_free_str(error) };
+            }
+            Err(GiacError::Interrupted)
+        } else if error == std::ptr::null() {
+            Ok(result)
+        } else {
+            Err(GiacError::InternalError(error.into()))
+        }
+    }
+
+    /// Serializes the expression to a compact binary form using giac's archive machinery.
+    /// Unlike a string round-trip, reloading with [Gen::unarchive] does not re-run the parser.
+    /// ```
+    /// use giacrs::context::Context;
+    /// use giacrs::gen::Gen;
+    ///
+    /// let ctx = Context::new();
+    /// let e = Gen::from_str("x^2+1", &ctx)?;
+    ///
+    /// let bytes = e.archive(&ctx)?;
+    /// assert_eq!("x^2+1", Gen::unarchive(&bytes, &ctx)?.to_string());
+    /// # use giacrs::GiacError;
+    /// # Ok::<(), GiacError>(())
+    /// ```
+    pub fn archive(&self, ctx: &Context) -> Result<Vec<u8>, GiacError> {
+        let mut buf: *const std::os::raw::c_char = std::ptr::null();
+        let mut len = 0;
+        let error = unsafe {
+            ffi::giacrs_gen_archive(self.as_gen_ref(), &mut buf, &mut len, ctx.as_context_ref())
+        };
+        if error == std::ptr::null() {
+            let bytes =
+                unsafe { std::slice::from_raw_parts(buf as *const u8, len) }.to_vec();
+            unsafe { ffi::giacrs_free_str(buf) };
+            Ok(bytes)
+        } else {
+            Err(GiacError::InternalError(error.into()))
+        }
+    }
+
+    /// Deserializes an expression saved with [Gen::archive], without touching the parser
+    pub fn unarchive(bytes: &[u8], ctx: &Context) -> Result<Self, GiacError> {
+        ffi_safe_call! {
+            ffi::giacrs_gen_unarchive(
+                bytes.as_ptr() as *const std::os::raw::c_char,
+                bytes.len(),
+                result.as_gen_ref(),
+                ctx.as_context_ref(),
+            )
+        }
+    }
+
     /// Returns the giac type of the expression. See [GenType]
     /// ```
     /// use giacrs::gen::Gen;
@@ -105,6 +353,58 @@ impl Gen {
         unsafe { ffi::giacrs_gen_type(self.as_gen_ref()) }
     }
 
+    /// Returns true if the expression is an integer (machine or arbitrary precision)
+    /// ```
+    /// use giacrs::gen::Gen;
+    ///
+    /// assert!(Gen::from(42).is_integer());
+    /// assert!(!Gen::from(0.5).is_integer());
+    /// ```
+    pub fn is_integer(&self) -> bool {
+        unsafe { ffi::giacrs_gen_is_integer(self.as_gen_ref()) }
+    }
+
+    /// Converts a machine-integer expression to an `i32` with no exception frame and no
+    /// type check, for numeric inner loops where the type is already known.
+    ///
+    /// # Safety
+    /// The expression type must be [GenType::Int], otherwise the value read is garbage.
+    /// ```
+    /// use giacrs::gen::Gen;
+    /// use giacrs::types::GenType;
+    ///
+    /// let e = Gen::from(42);
+    /// assert_eq!(GenType::Int, e.get_type());
+    /// assert_eq!(42, unsafe { e.to_int_unchecked() });
+    /// ```
+    pub unsafe fn to_int_unchecked(&self) -> i32 {
+        ffi::giacrs_gen_to_int_unchecked(self.as_gen_ref())
+    }
+
+    /// Checks a machine integer against zero without the exception frame of [Gen::is_zero].
+    ///
+    /// # Safety
+    /// The expression type must be [GenType::Int]
+    pub unsafe fn is_zero_unchecked(&self) -> bool {
+        ffi::giacrs_gen_is_zero_unchecked(self.as_gen_ref())
+    }
+
+    /// Parity of a machine integer, as a direct bit test.
+    ///
+    /// # Safety
+    /// The expression type must be [GenType::Int]
+    pub unsafe fn is_even_unchecked(&self) -> bool {
+        ffi::giacrs_gen_even_unchecked(self.as_gen_ref())
+    }
+
+    /// Sign of a machine integer (-1, 0 or 1), as direct comparisons.
+    ///
+    /// # Safety
+    /// The expression type must be [GenType::Int]
+    pub unsafe fn sign_unchecked(&self) -> i8 {
+        ffi::giacrs_gen_sign_unchecked(self.as_gen_ref())
+    }
+
     /// Checks if the expression equals zero
     /// ```
     /// use giacrs::context::Context;
@@ -129,6 +429,68 @@ impl Gen {
         }
     }
 
+    /// Checks a whole slice against zero in one FFI call and a linear scan, with a direct
+    /// field read for machine integers, instead of one [Gen::is_zero] round trip per element.
+    /// ```
+    /// use giacrs::context::Context;
+    /// use giacrs::gen::Gen;
+    ///
+    /// let ctx = Context::new();
+    /// let values = vec![Gen::from(0), Gen::from(10)];
+    ///
+    /// assert_eq!(vec![true, false], Gen::is_zero_batch(&values, &ctx)?);
+    /// # use giacrs::GiacError;
+    /// # Ok::<(), GiacError>(())
+    /// ```
+    pub fn is_zero_batch(values: &[Gen], ctx: &Context) -> Result<Vec<bool>, GiacError> {
+        let inputs: Vec<_> = values.iter().map(|e| unsafe { e.as_gen_ref() }).collect();
+        let mut out = vec![0u8; values.len()];
+        let error = unsafe {
+            ffi::giacrs_gen_is_zero_batch(
+                inputs.as_ptr(),
+                values.len(),
+                out.as_mut_ptr(),
+                ctx.as_context_ref(),
+            )
+        };
+        if error == std::ptr::null() {
+            Ok(out.into_iter().map(|r| r != 0).collect())
+        } else {
+            Err(GiacError::InternalError(error.into()))
+        }
+    }
+
+    /// Returns the sign (`-1`, `0` or `1`) of every element of a slice in one FFI call, with
+    /// a direct field read for machine integers.
+    /// ```
+    /// use giacrs::context::Context;
+    /// use giacrs::gen::Gen;
+    ///
+    /// let ctx = Context::new();
+    /// let values = vec![Gen::from(-3), Gen::from(0), Gen::from(7)];
+    ///
+    /// assert_eq!(vec![-1, 0, 1], Gen::sign_batch(&values, &ctx)?);
+    /// # use giacrs::GiacError;
+    /// # Ok::<(), GiacError>(())
+    /// ```
+    pub fn sign_batch(values: &[Gen], ctx: &Context) -> Result<Vec<i8>, GiacError> {
+        let inputs: Vec<_> = values.iter().map(|e| unsafe { e.as_gen_ref() }).collect();
+        let mut out = vec![0i8; values.len()];
+        let error = unsafe {
+            ffi::giacrs_gen_sign_batch(
+                inputs.as_ptr(),
+                values.len(),
+                out.as_mut_ptr(),
+                ctx.as_context_ref(),
+            )
+        };
+        if error == std::ptr::null() {
+            Ok(out)
+        } else {
+            Err(GiacError::InternalError(error.into()))
+        }
+    }
+
     /// Factorizes the expression.
     /// ```
     /// use giacrs::context::Context;
@@ -161,6 +523,78 @@ impl Gen {
         ffi_safe_call! { ffi::giacrs_gen_simplify(self.as_gen_ref(),result.as_gen_ref(), ctx.as_context_ref()) }
     }
 
+    /// Builds a giac vector directly from a slice of doubles, without going through the parser.
+    /// ```
+    /// use giacrs::gen::Gen;
+    /// use giacrs::types::GenType;
+    ///
+    /// let v = Gen::from_doubles(&[1.0, 2.5, -3.0]);
+    /// assert_eq!(GenType::Vector, v.get_type());
+    /// assert_eq!(vec![1.0, 2.5, -3.0], v.to_doubles()?);
+    /// # use giacrs::GiacError;
+    /// # Ok::<(), GiacError>(())
+    /// ```
+    pub fn from_doubles(values: &[f64]) -> Self {
+        Self(unsafe { ffi::giacrs_gen_vecteur_from_doubles(values.as_ptr(), values.len()) })
+    }
+
+    /// Builds a giac vector directly from a slice of integers, without going through the parser.
+    /// ```
+    /// use giacrs::gen::Gen;
+    ///
+    /// let v = Gen::from_ints(&[2, 3, 5]);
+    /// assert_eq!("[2,3,5]", v.to_string());
+    /// ```
+    pub fn from_ints(values: &[i64]) -> Self {
+        Self(unsafe { ffi::giacrs_gen_vecteur_from_ints(values.as_ptr(), values.len()) })
+    }
+
+    /// Builds a matrix from a contiguous row-major slice of doubles, without going through
+    /// the parser. For big numeric matrices this is a single linear pass instead of a parse
+    /// of a megabyte-long string.
+    ///
+    /// Panics if `values.len() != rows * cols`.
+    /// ```
+    /// use giacrs::context::Context;
+    /// use giacrs::gen::Gen;
+    ///
+    /// let ctx = Context::new();
+    /// let mat = Gen::matrix_from_doubles(&[1.0, 2.0, 3.0, 4.0], 2, 2);
+    ///
+    /// assert!((mat.det(&ctx)? - &Gen::from(-2.0)).is_zero(&ctx)?);
+    /// # use giacrs::GiacError;
+    /// # Ok::<(), GiacError>(())
+    /// ```
+    pub fn matrix_from_doubles(values: &[f64], rows: usize, cols: usize) -> Self {
+        assert_eq!(values.len(), rows * cols);
+        Self(unsafe { ffi::giacrs_gen_matrix_from_doubles(values.as_ptr(), rows, cols) })
+    }
+
+    /// Returns the number of elements of a vector expression
+    pub fn len(&self) -> Result<usize, GiacError> {
+        let mut result = 0;
+        let error = unsafe { ffi::giacrs_gen_vecteur_len(self.as_gen_ref(), &mut result) };
+        if error == std::ptr::null() {
+            Ok(result)
+        } else {
+            Err(GiacError::InternalError(error.into()))
+        }
+    }
+
+    /// Reads a numeric vector expression back into a [Vec] of doubles in one pass.
+    /// Fails if the expression is not a vector or contains non numeric elements.
+    pub fn to_doubles(&self) -> Result<Vec<f64>, GiacError> {
+        let len = self.len()?;
+        let mut out = vec![0.0; len];
+        let error =
+            unsafe { ffi::giacrs_gen_vecteur_to_doubles(self.as_gen_ref(), out.as_mut_ptr(), len) };
+        if error == std::ptr::null() {
+            Ok(out)
+        } else {
+            Err(GiacError::InternalError(error.into()))
+        }
+    }
+
     /// Computes the determinant of the matrix.
     /// ```
     /// use giacrs::context::Context;
@@ -178,6 +612,21 @@ impl Gen {
         ffi_safe_call! { ffi::giacrs_gen_det(self.as_gen_ref(),result.as_gen_ref(), ctx.as_context_ref()) }
     }
 
+    /// Computes `self += a*b` in place, as a single FFI call with no intermediate gens.
+    /// This is the fastest way to accumulate products in a loop.
+    /// ```
+    /// use giacrs::gen::Gen;
+    ///
+    /// let mut acc = Gen::from(1);
+    /// acc.add_mul(&2.into(), &3.into());
+    /// assert_eq!(7, acc.to_int()?);
+    /// # use giacrs::GiacError;
+    /// # Ok::<(), GiacError>(())
+    /// ```
+    pub fn add_mul(&mut self, a: &Gen, b: &Gen) {
+        ffi_safe_panic_inplace_call! { ffi::giacrs_gen_fma(self.as_gen_ref(), a.as_gen_ref(), b.as_gen_ref()) };
+    }
+
     // GIAC METHODS
 
     /// Converts a floating point number d to a rational number q approaching d such that `abs(q-d) < epsilon` ([Context::set_epsilon])
@@ -271,11 +720,17 @@ impl TryFrom<Gen> for i32 {
 
 impl Display for Gen {
     fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
-        write!(f, "{}", self.print_to_string())
+        let mut out = String::new();
+        self.print_into(&mut out);
+        write!(f, "{}", out)
     }
 }
 
 impl Clone for Gen {
+    /// Cloning is cheap: giac reference-counts the heavy payloads (big integers, vectors,
+    /// symbolic trees, ...), so a clone is a refcount bump plus a gen shell taken from the
+    /// wrapper's cache, not a deep copy. The two clones still behave as independent values
+    /// since giac copies on write.
     fn clone(&self) -> Self {
         Self(unsafe { ffi::giacrs_gen_clone(self.as_gen_ref()) })
     }
@@ -291,7 +746,7 @@ impl Add<&Self> for Gen {
 }
 impl AddAssign<&Self> for Gen {
     fn add_assign(&mut self, rhs: &Self) {
-        ffi_safe_panic_inplace_call! { ffi::giacrs_gen_add(self.as_gen_ref(), rhs.as_gen_ref()) };
+        ffi_safe_panic_inplace_call! { ffi::giacrs_gen_add_inplace(self.as_gen_ref(), rhs.as_gen_ref()) };
     }
 }
 
@@ -305,7 +760,7 @@ impl Sub<&Self> for Gen {
 }
 impl SubAssign<&Self> for Gen {
     fn sub_assign(&mut self, rhs: &Self) {
-        ffi_safe_panic_inplace_call! { ffi::giacrs_gen_sub(self.as_gen_ref(), rhs.as_gen_ref()) };
+        ffi_safe_panic_inplace_call! { ffi::giacrs_gen_sub_inplace(self.as_gen_ref(), rhs.as_gen_ref()) };
     }
 }
 
@@ -319,7 +774,7 @@ impl Mul<&Self> for Gen {
 }
 impl MulAssign<&Self> for Gen {
     fn mul_assign(&mut self, rhs: &Self) {
-        ffi_safe_panic_inplace_call! { ffi::giacrs_gen_mul(self.as_gen_ref(), rhs.as_gen_ref()) };
+        ffi_safe_panic_inplace_call! { ffi::giacrs_gen_mul_inplace(self.as_gen_ref(), rhs.as_gen_ref()) };
     }
 }
 
@@ -358,3 +813,74 @@ impl Drop for Gen {
         unsafe { ffi::giacrs_free_gen(self.as_gen_ref()) };
     }
 }
+
+impl Gen {
+    /// Frees a whole collection in one FFI call, instead of the one call per value that
+    /// dropping each [Gen] costs. Worth it when tearing down large intermediate result sets;
+    /// see [DropQueue] for the incremental variant.
+    /// ```
+    /// use giacrs::gen::Gen;
+    ///
+    /// let gens: Vec<Gen> = (0..10_000).map(Gen::from).collect();
+    /// Gen::free_batch(gens);
+    /// ```
+    pub fn free_batch(gens: Vec<Gen>) {
+        let refs: Vec<GiacGenRef> = gens.iter().map(|g| unsafe { g.as_gen_ref() }).collect();
+        unsafe { ffi::giacrs_free_gen_batch(refs.as_ptr(), refs.len()) };
+        for g in gens {
+            std::mem::forget(g);
+        }
+    }
+}
+
+/// Batches [Gen] drops and releases them in bulk: pushed gens are freed together once the
+/// queue reaches its threshold, and whatever remains is flushed when the queue itself is
+/// dropped. Tearing down millions of values this way is one FFI transition per batch
+/// instead of one per value.
+/// ```
+/// use giacrs::gen::{DropQueue, Gen};
+///
+/// let mut queue = DropQueue::new(4096);
+/// for i in 0..10_000 {
+///     queue.push(Gen::from(i));
+/// }
+/// // the rest is flushed here, when `queue` goes out of scope
+/// ```
+pub struct DropQueue {
+    handles: Vec<GiacGenRef>,
+    threshold: usize,
+}
+
+impl DropQueue {
+    /// Creates a queue flushing automatically every `threshold` pushed gens
+    pub fn new(threshold: usize) -> Self {
+        Self {
+            handles: Vec::with_capacity(threshold),
+            threshold: threshold.max(1),
+        }
+    }
+
+    /// Hands a [Gen] over to the queue; it is freed at the next flush
+    pub fn push(&mut self, gen: Gen) {
+        self.handles.push(unsafe { gen.as_gen_ref() });
+        std::mem::forget(gen);
+        if self.handles.len() >= self.threshold {
+            self.flush();
+        }
+    }
+
+    /// Frees everything currently queued in one FFI call
+    pub fn flush(&mut self) {
+        if self.handles.is_empty() {
+            return;
+        }
+        unsafe { ffi::giacrs_free_gen_batch(self.handles.as_ptr(), self.handles.len()) };
+        self.handles.clear();
+    }
+}
+
+impl Drop for DropQueue {
+    fn drop(&mut self) {
+        self.flush();
+    }
+}
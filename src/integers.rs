@@ -418,6 +418,300 @@ impl Gen {
     pub fn euler(&self, ctx: &Context) -> Result<Self, GiacError> {
         ffi_safe_call! { ffi::giacrs_gen_euler(self.as_gen_ref(), result.as_gen_ref(), ctx.as_context_ref()) }
     }
+
+    /// Exports an integer as its little-endian magnitude bytes and a sign (`-1`, `0` or `1`),
+    /// copied straight out of the underlying GMP representation. With [Gen::from_bytes] this
+    /// moves big integers to and from crates like num-bigint as one linear copy, instead of a
+    /// decimal print/re-parse whose cost grows quadratically with the size of the number.
+    /// Fails if the expression is not an integer.
+    /// ```
+    /// use giacrs::gen::Gen;
+    ///
+    /// let (bytes, sign) = Gen::from(-258).to_bytes()?;
+    /// assert_eq!(vec![2, 1], bytes);
+    /// assert_eq!(-1, sign);
+    /// # use giacrs::GiacError;
+    /// # Ok::<(), GiacError>(())
+    /// ```
+    pub fn to_bytes(&self) -> Result<(Vec<u8>, i8), GiacError> {
+        let mut len = 0;
+        let error = unsafe { ffi::giacrs_gen_byte_size(self.as_gen_ref(), &mut len) };
+        if error != std::ptr::null() {
+            return Err(GiacError::InternalError(error.into()));
+        }
+        let mut bytes = vec![0u8; len];
+        let mut sign = 0i8;
+        let error =
+            unsafe { ffi::giacrs_gen_to_bytes(self.as_gen_ref(), bytes.as_mut_ptr(), &mut sign) };
+        if error == std::ptr::null() {
+            Ok((bytes, sign))
+        } else {
+            Err(GiacError::InternalError(error.into()))
+        }
+    }
+
+    /// Builds an integer from little-endian magnitude bytes and a sign, the inverse of
+    /// [Gen::to_bytes].
+    /// ```
+    /// use giacrs::context::Context;
+    /// use giacrs::gen::Gen;
+    ///
+    /// let ctx = Context::new();
+    /// let n = ctx.eval("2^300+7")?;
+    ///
+    /// let (bytes, sign) = n.to_bytes()?;
+    /// assert_eq!(n.to_string(), Gen::from_bytes(&bytes, sign).to_string());
+    /// # use giacrs::GiacError;
+    /// # Ok::<(), GiacError>(())
+    /// ```
+    pub fn from_bytes(bytes: &[u8], sign: i8) -> Self {
+        Self(unsafe { ffi::giacrs_gen_from_bytes(bytes.as_ptr(), bytes.len(), sign) })
+    }
+}
+
+/// Returns the Greatest Common Divisor of a whole slice, folded inside a single FFI call with
+/// an early exit once the accumulator reaches 1. See [Gen::gcd]
+/// ```
+/// use giacrs::context::Context;
+/// use giacrs::gen::Gen;
+/// use giacrs::integers::gcd_list;
+///
+/// let ctx = Context::new();
+/// let values = vec![Gen::from(18), Gen::from(12), Gen::from(30)];
+///
+/// assert_eq!(6, gcd_list(&values, &ctx)?.to_int()?);
+/// # use giacrs::GiacError;
+/// # Ok::<(), GiacError>(())
+/// ```
+pub fn gcd_list(values: &[Gen], ctx: &Context) -> Result<Gen, GiacError> {
+    let inputs: Vec<_> = values.iter().map(|e| unsafe { e.as_gen_ref() }).collect();
+    let result = Gen::new();
+    let error = unsafe {
+        ffi::giacrs_gen_gcd_n(
+            inputs.as_ptr(),
+            values.len(),
+            result.as_gen_ref(),
+            ctx.as_context_ref(),
+        )
+    };
+    if error == std::ptr::null() {
+        Ok(result)
+    } else {
+        Err(GiacError::InternalError(error.into()))
+    }
+}
+
+/// Returns the Least Common Multiple of a whole slice, folded inside a single FFI call.
+/// See [Gen::lcm]
+/// ```
+/// use giacrs::gen::Gen;
+/// use giacrs::integers::lcm_list;
+///
+/// let values = vec![Gen::from(2), Gen::from(3), Gen::from(4)];
+///
+/// assert_eq!(12, lcm_list(&values)?.to_int()?);
+/// # use giacrs::GiacError;
+/// # Ok::<(), GiacError>(())
+/// ```
+pub fn lcm_list(values: &[Gen]) -> Result<Gen, GiacError> {
+    let inputs: Vec<_> = values.iter().map(|e| unsafe { e.as_gen_ref() }).collect();
+    let result = Gen::new();
+    let error =
+        unsafe { ffi::giacrs_gen_lcm_n(inputs.as_ptr(), values.len(), result.as_gen_ref()) };
+    if error == std::ptr::null() {
+        Ok(result)
+    } else {
+        Err(GiacError::InternalError(error.into()))
+    }
+}
+
+/// Factors a whole slice of integers concurrently inside the wrapper, using `threads` worker
+/// threads (0 means one per hardware core), each with its own pooled context. Results come back
+/// in input order; a hard number only stalls the worker holding it. See [Gen::ifactors]
+/// ```
+/// use giacrs::gen::Gen;
+/// use giacrs::integers::ifactors_batch;
+///
+/// let values = vec![Gen::from(90), Gen::from(1400)];
+///
+/// let mut results = ifactors_batch(&values, 2).into_iter();
+/// assert_eq!("[2,1,3,2,5,1]", results.next().unwrap()?.to_string());
+/// assert_eq!("[2,3,5,2,7,1]", results.next().unwrap()?.to_string());
+/// # use giacrs::GiacError;
+/// # Ok::<(), GiacError>(())
+/// ```
+pub fn ifactors_batch(values: &[Gen], threads: usize) -> Vec<Result<Gen, GiacError>> {
+    let inputs: Vec<_> = values.iter().map(|e| unsafe { e.as_gen_ref() }).collect();
+    let results: Vec<Gen> = values.iter().map(|_| Gen::new()).collect();
+    let outputs: Vec<_> = results.iter().map(|e| unsafe { e.as_gen_ref() }).collect();
+    let mut statuses: Vec<ffi::GiacResult> = vec![std::ptr::null(); values.len()];
+    unsafe {
+        ffi::giacrs_gen_ifactors_batch(
+            inputs.as_ptr(),
+            outputs.as_ptr(),
+            statuses.as_mut_ptr(),
+            values.len(),
+            threads,
+        )
+    };
+    results
+        .into_iter()
+        .zip(statuses)
+        .map(|(gen, error)| {
+            if error == std::ptr::null() {
+                Ok(gen)
+            } else {
+                Err(GiacError::InternalError(error.into()))
+            }
+        })
+        .collect()
+}
+
+/// Reduces every element of `values` by the same modulus, in place, in a single FFI call.
+/// Machine-integer elements are reduced with one native division each; big integers fall
+/// back to giac. See [Gen::irem]
+/// ```
+/// use giacrs::gen::Gen;
+/// use giacrs::integers::irem_batch;
+///
+/// let mut values = vec![Gen::from(148), Gen::from(1000)];
+/// irem_batch(&mut values, &5.into())?;
+///
+/// assert_eq!(3, values[0].to_int()?);
+/// assert_eq!(0, values[1].to_int()?);
+/// # use giacrs::GiacError;
+/// # Ok::<(), GiacError>(())
+/// ```
+pub fn irem_batch(values: &mut [Gen], modulus: &Gen) -> Result<(), GiacError> {
+    let inputs: Vec<_> = values.iter().map(|e| unsafe { e.as_gen_ref() }).collect();
+    let error = unsafe {
+        ffi::giacrs_gen_irem_batch(inputs.as_ptr(), values.len(), modulus.as_gen_ref())
+    };
+    if error == std::ptr::null() {
+        Ok(())
+    } else {
+        Err(GiacError::InternalError(error.into()))
+    }
+}
+
+/// Returns all prime numbers in `[lo, hi)`, sieving the whole range in a single FFI call.
+/// For enumerating primes this is orders of magnitude faster than repeated [Gen::next_prime] calls.
+/// ```
+/// use giacrs::integers::prime_sieve;
+///
+/// assert_eq!(vec![11, 13, 17, 19], prime_sieve(10, 20));
+/// ```
+pub fn prime_sieve(lo: u64, hi: u64) -> Vec<u64> {
+    if hi <= lo {
+        return vec![];
+    }
+    let mut flags = vec![0u8; (hi - lo) as usize];
+    unsafe { ffi::giacrs_prime_sieve(lo, hi, flags.as_mut_ptr()) };
+    flags
+        .iter()
+        .enumerate()
+        .filter(|(_, &prime)| prime != 0)
+        .map(|(i, _)| lo + i as u64)
+        .collect()
+}
+
+/// Tests the parity of a whole slice in one FFI call and a linear scan, with a direct bit
+/// test for machine integers, instead of one [Gen::is_even] round trip per element.
+/// ```
+/// use giacrs::context::Context;
+/// use giacrs::gen::Gen;
+/// use giacrs::integers::even_batch;
+///
+/// let ctx = Context::new();
+/// let values = vec![Gen::from(4), Gen::from(7)];
+///
+/// assert_eq!(vec![true, false], even_batch(&values, &ctx)?);
+/// # use giacrs::GiacError;
+/// # Ok::<(), GiacError>(())
+/// ```
+pub fn even_batch(values: &[Gen], ctx: &Context) -> Result<Vec<bool>, GiacError> {
+    let inputs: Vec<_> = values.iter().map(|e| unsafe { e.as_gen_ref() }).collect();
+    let mut out = vec![0u8; values.len()];
+    let error = unsafe {
+        ffi::giacrs_gen_even_batch(
+            inputs.as_ptr(),
+            values.len(),
+            out.as_mut_ptr(),
+            ctx.as_context_ref(),
+        )
+    };
+    if error == std::ptr::null() {
+        Ok(out.into_iter().map(|r| r != 0).collect())
+    } else {
+        Err(GiacError::InternalError(error.into()))
+    }
+}
+
+/// Tests the oddness of a whole slice in one FFI call, the counterpart of [even_batch].
+/// ```
+/// use giacrs::context::Context;
+/// use giacrs::gen::Gen;
+/// use giacrs::integers::odd_batch;
+///
+/// let ctx = Context::new();
+/// let values = vec![Gen::from(4), Gen::from(7)];
+///
+/// assert_eq!(vec![false, true], odd_batch(&values, &ctx)?);
+/// # use giacrs::GiacError;
+/// # Ok::<(), GiacError>(())
+/// ```
+pub fn odd_batch(values: &[Gen], ctx: &Context) -> Result<Vec<bool>, GiacError> {
+    let inputs: Vec<_> = values.iter().map(|e| unsafe { e.as_gen_ref() }).collect();
+    let mut out = vec![0u8; values.len()];
+    let error = unsafe {
+        ffi::giacrs_gen_odd_batch(
+            inputs.as_ptr(),
+            values.len(),
+            out.as_mut_ptr(),
+            ctx.as_context_ref(),
+        )
+    };
+    if error == std::ptr::null() {
+        Ok(out.into_iter().map(|r| r != 0).collect())
+    } else {
+        Err(GiacError::InternalError(error.into()))
+    }
+}
+
+/// Checks pseudoprimality ([PseudoPrime]) of a whole slice of numbers in a single FFI call.
+/// See [Gen::is_pseudoprime]
+/// ```
+/// use giacrs::gen::Gen;
+/// use giacrs::integers::{is_pseudoprime_batch, PseudoPrime};
+///
+/// let values = vec![Gen::from(14), Gen::from(100003)];
+///
+/// assert_eq!(
+///     vec![PseudoPrime::NotPrime, PseudoPrime::Prime],
+///     is_pseudoprime_batch(&values)?
+/// );
+/// # use giacrs::GiacError;
+/// # Ok::<(), GiacError>(())
+/// ```
+pub fn is_pseudoprime_batch(values: &[Gen]) -> Result<Vec<PseudoPrime>, GiacError> {
+    let inputs: Vec<_> = values.iter().map(|e| unsafe { e.as_gen_ref() }).collect();
+    let mut out = vec![0i8; values.len()];
+    let error = unsafe {
+        ffi::giacrs_gen_is_pseudoprime_batch(inputs.as_ptr(), values.len(), out.as_mut_ptr())
+    };
+    if error == std::ptr::null() {
+        Ok(out
+            .into_iter()
+            .map(|r| match r {
+                0 => PseudoPrime::NotPrime,
+                1 => PseudoPrime::PseudoPrime,
+                2 => PseudoPrime::Prime,
+                _ => unreachable!(),
+            })
+            .collect())
+    } else {
+        Err(GiacError::InternalError(error.into()))
+    }
 }
 
 /// Solve the equation `u*a + v*b = c`.
@@ -1,13 +1,19 @@
 #![doc = include_str!("../README.md")]
 #![warn(missing_docs)]
 
+pub mod arena;
+pub mod compiled;
 pub mod context;
 mod ffi;
 pub mod gen;
+pub mod memo;
+pub mod numeric;
+pub mod parallel;
 
 mod support;
 pub use support::*;
 pub mod options;
+pub mod stats;
 pub mod types;
 
 pub mod combinatory;
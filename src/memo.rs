@@ -0,0 +1,42 @@
+//! Opt-in memoization of simplify, factor and ifactors
+//!
+//! Repetitive workloads hit the expensive pure transforms with the same inputs over and
+//! over. When enabled, the wrapper keeps one bounded process-wide LRU cache over
+//! [crate::gen::Gen::simplify], [crate::gen::Gen::factor] and [crate::gen::Gen::ifactors],
+//! keyed by the input expression. Hit and miss counts are reported through
+//! [crate::stats::snapshot].
+//!
+//! The cache ignores context settings, so keep it disabled (the default) if different
+//! contexts are expected to simplify the same input differently (e.g. different epsilon).
+//! It is safe to use from multiple threads: results enter and leave the cache as deep
+//! copies, so a cached hit never shares state with another caller.
+
+use crate::ffi;
+
+/// Enables the memoization cache, bounded to `capacity` entries evicted least recently
+/// used first. Calling it again resizes the cache, shrinking it if needed; a `capacity`
+/// of 0 is equivalent to [disable].
+/// ```
+/// use giacrs::context::Context;
+/// use giacrs::{memo, stats};
+///
+/// memo::enable(10_000);
+/// let ctx = Context::new();
+/// let expr = ctx.eval("'cos(x)^2+sin(x)^2'")?;
+///
+/// expr.simplify(&ctx)?;
+/// let before = stats::snapshot();
+/// expr.simplify(&ctx)?;
+/// assert!(stats::snapshot().memo_hits > before.memo_hits);
+/// # memo::disable();
+/// # use giacrs::GiacError;
+/// # Ok::<(), GiacError>(())
+/// ```
+pub fn enable(capacity: usize) {
+    unsafe { ffi::giacrs_memo_enable(capacity) };
+}
+
+/// Disables the memoization cache and drops all cached entries.
+pub fn disable() {
+    unsafe { ffi::giacrs_memo_disable() };
+}
@@ -0,0 +1,81 @@
+//! Dense double-precision linear algebra, bypassing symbolic dispatch
+//!
+//! Routing a purely numeric matrix through [crate::gen::Gen] boxes every element and pays
+//! giac's per-element type dispatch. The functions here operate on contiguous row-major
+//! `f64` buffers with native kernels: use them when the data is known to be numeric, and
+//! the gen-based matrix routines when it may be symbolic or exact.
+
+use crate::{ffi, GiacError};
+
+/// Determinant of an `n`x`n` row-major matrix. A singular matrix yields `0.0`.
+/// ```
+/// use giacrs::numeric::det;
+///
+/// let m = [1.0, 2.0, 3.0, 4.0];
+/// assert_eq!(-2.0, det(&m, 2)?);
+/// # use giacrs::GiacError;
+/// # Ok::<(), GiacError>(())
+/// ```
+pub fn det(matrix: &[f64], n: usize) -> Result<f64, GiacError> {
+    assert_eq!(matrix.len(), n * n);
+    let mut res = 0.0;
+    let error = unsafe { ffi::giacrs_dmat_det(matrix.as_ptr(), n, &mut res) };
+    if error == std::ptr::null() {
+        Ok(res)
+    } else {
+        Err(GiacError::InternalError(error.into()))
+    }
+}
+
+/// Solves `A X = B` by LU decomposition with partial pivoting, where `A` is `n`x`n` and
+/// `B` is `n`x`nrhs`, both row-major. Returns `X` row-major. Fails if `A` is singular.
+/// ```
+/// use giacrs::numeric::lu_solve;
+///
+/// let a = [2.0, 0.0, 0.0, 4.0];
+/// let b = [6.0, 8.0];
+/// assert_eq!(vec![3.0, 2.0], lu_solve(&a, &b, 2, 1)?);
+/// # use giacrs::GiacError;
+/// # Ok::<(), GiacError>(())
+/// ```
+pub fn lu_solve(matrix: &[f64], b: &[f64], n: usize, nrhs: usize) -> Result<Vec<f64>, GiacError> {
+    assert_eq!(matrix.len(), n * n);
+    assert_eq!(b.len(), n * nrhs);
+    let mut x = vec![0.0; n * nrhs];
+    let error =
+        unsafe { ffi::giacrs_dmat_lu_solve(matrix.as_ptr(), b.as_ptr(), n, nrhs, x.as_mut_ptr()) };
+    if error == std::ptr::null() {
+        Ok(x)
+    } else {
+        Err(GiacError::InternalError(error.into()))
+    }
+}
+
+/// Multiplies an `m`x`k` matrix by a `k`x`n` matrix, all row-major.
+/// ```
+/// use giacrs::numeric::mat_mul;
+///
+/// let a = [1.0, 2.0, 3.0, 4.0];
+/// let identity = [1.0, 0.0, 0.0, 1.0];
+/// assert_eq!(a.to_vec(), mat_mul(&a, &identity, 2, 2, 2));
+/// ```
+pub fn mat_mul(a: &[f64], b: &[f64], m: usize, k: usize, n: usize) -> Vec<f64> {
+    assert_eq!(a.len(), m * k);
+    assert_eq!(b.len(), k * n);
+    let mut c = vec![0.0; m * n];
+    unsafe { ffi::giacrs_dmat_mul(a.as_ptr(), b.as_ptr(), c.as_mut_ptr(), m, k, n) };
+    c
+}
+
+/// Numerical rank of a `rows`x`cols` row-major matrix, computed by Gaussian elimination
+/// with a scale-aware tolerance.
+/// ```
+/// use giacrs::numeric::rank;
+///
+/// let m = [1.0, 2.0, 2.0, 4.0];
+/// assert_eq!(1, rank(&m, 2, 2));
+/// ```
+pub fn rank(matrix: &[f64], rows: usize, cols: usize) -> usize {
+    assert_eq!(matrix.len(), rows * cols);
+    unsafe { ffi::giacrs_dmat_rank(matrix.as_ptr(), rows, cols) }
+}
@@ -22,4 +22,56 @@ impl Context {
     pub fn set_epsilon(&mut self, epsilon: f64) {
         unsafe { ffi::giacrs_options_set_epsilon(epsilon, self.as_context_ref()) };
     }
+
+    /// Change the probabilistic-algorithm epsilon for this context. A non-zero value allows
+    /// giac to take much faster Monte Carlo paths (gcd, determinant, resultant) whose answer
+    /// is wrong with probability at most `epsilon`; `0.0` forces the deterministic algorithms.
+    /// ```
+    /// use giacrs::context::Context;
+    ///
+    /// let mut ctx = Context::new();
+    /// ctx.set_proba_epsilon(1e-15);
+    /// assert_eq!(1e-15, ctx.proba_epsilon());
+    /// ```
+    pub fn set_proba_epsilon(&mut self, epsilon: f64) {
+        unsafe { ffi::giacrs_options_set_proba_epsilon(epsilon, self.as_context_ref()) };
+    }
+
+    /// Returns the probabilistic-algorithm epsilon of this context, see
+    /// [Context::set_proba_epsilon]
+    pub fn proba_epsilon(&self) -> f64 {
+        unsafe { ffi::giacrs_options_proba_epsilon(self.as_context_ref()) }
+    }
+}
+
+/// Sets the number of threads giac's internal parallel algorithms may use. giac keeps this
+/// as a process-wide setting, so it applies to every context. Values below 1 are clamped
+/// to 1.
+/// ```
+/// use giacrs::options;
+///
+/// options::set_threads(4);
+/// assert_eq!(4, options::threads());
+/// # options::set_threads(1);
+/// ```
+pub fn set_threads(n: u32) {
+    unsafe { ffi::giacrs_options_set_threads(n as std::os::raw::c_int) };
+}
+
+/// Returns the number of threads giac's internal parallel algorithms may use, see
+/// [set_threads]
+pub fn threads() -> u32 {
+    unsafe { ffi::giacrs_options_threads() as u32 }
+}
+
+/// Sets giac's maximum evaluation recursion depth, a process-wide guard against runaway
+/// recursive computations. Lower it to fail faster on pathological input, raise it for
+/// legitimately deep expressions.
+pub fn set_max_recursion(n: u32) {
+    unsafe { ffi::giacrs_options_set_max_recursion(n as std::os::raw::c_int) };
+}
+
+/// Returns giac's maximum evaluation recursion depth, see [set_max_recursion]
+pub fn max_recursion() -> u32 {
+    unsafe { ffi::giacrs_options_max_recursion() as u32 }
 }
@@ -0,0 +1,152 @@
+//! Parallel map/reduce over a managed pool of contexts
+//!
+//! A giac context is not safe for concurrent mutation, and gens are reference-counted
+//! with plain non-atomic ints, so a correct parallel layer needs one context per worker
+//! and must never let two threads touch gens sharing a payload. The functions here own
+//! that scaffolding: every input is **deep-copied at the thread boundary** (so workers
+//! share nothing with the caller), work is split into contiguous chunks, each worker
+//! checks a context out of the internal pool (see [Context::checkout]) for its whole
+//! chunk, and results come back in input order. Contexts return to the pool with their
+//! user variables and options reset, so nothing leaks between calls.
+
+use crate::{context::Context, ffi, gen::Gen, GiacError};
+
+fn resolve_threads(threads: usize, len: usize) -> usize {
+    let threads = if threads == 0 {
+        std::thread::available_parallelism()
+            .map(std::num::NonZeroUsize::get)
+            .unwrap_or(1)
+    } else {
+        threads
+    };
+    threads.min(len).max(1)
+}
+
+/// A gen handle that may cross a thread boundary: only ever built from a deep copy (or
+/// from a gen computed entirely on the sending thread and handed over after a join), so
+/// no other live gen shares its reference-counted payload.
+struct SendRef(crate::gen::GiacGenRef);
+unsafe impl Send for SendRef {}
+
+impl SendRef {
+    fn deep_copy_of(gen: &Gen) -> Self {
+        Self(unsafe { ffi::giacrs_gen_deep_copy(gen.as_gen_ref()) })
+    }
+
+    fn from_owned(gen: Gen) -> Self {
+        let r = Self(unsafe { gen.as_gen_ref() });
+        std::mem::forget(gen);
+        r
+    }
+
+    fn into_gen(self) -> Gen {
+        Gen(self.0)
+    }
+}
+
+fn split_chunks(inputs: &[Gen], threads: usize) -> Vec<Vec<SendRef>> {
+    let chunk = inputs.len().div_ceil(threads);
+    inputs
+        .chunks(chunk)
+        .map(|c| c.iter().map(SendRef::deep_copy_of).collect())
+        .collect()
+}
+
+/// Applies `f` to a deep copy of every input in parallel, each worker evaluating against
+/// its own pooled context. `threads == 0` uses the available parallelism. Results are in
+/// input order, one per input, so a failure on one element doesn't hide the others.
+/// ```
+/// use giacrs::gen::Gen;
+/// use giacrs::parallel::par_map;
+///
+/// let inputs: Vec<Gen> = (1..=20).map(Gen::from).collect();
+/// let squares = par_map(&inputs, 0, |g, ctx| ctx.eval(&format!("{}^2", g))?.to_int());
+///
+/// let squares = squares.into_iter().collect::<Result<Vec<_>, _>>()?;
+/// assert_eq!(400, squares[19]);
+/// # use giacrs::GiacError;
+/// # Ok::<(), GiacError>(())
+/// ```
+pub fn par_map<T, F>(inputs: &[Gen], threads: usize, f: F) -> Vec<Result<T, GiacError>>
+where
+    T: Send,
+    F: Fn(&Gen, &Context) -> Result<T, GiacError> + Sync,
+{
+    if inputs.is_empty() {
+        return Vec::new();
+    }
+    let threads = resolve_threads(threads, inputs.len());
+    let chunks = split_chunks(inputs, threads);
+    std::thread::scope(|s| {
+        let handles: Vec<_> = chunks
+            .into_iter()
+            .map(|chunk| {
+                let f = &f;
+                s.spawn(move || {
+                    let ctx = Context::checkout();
+                    chunk
+                        .into_iter()
+                        .map(|g| f(&g.into_gen(), &ctx))
+                        .collect::<Vec<_>>()
+                })
+            })
+            .collect();
+        handles
+            .into_iter()
+            .flat_map(|h| h.join().unwrap())
+            .collect()
+    })
+}
+
+/// Reduces deep copies of the inputs to a single value in parallel: each worker folds its
+/// chunk with `f` against a pooled context, then the partial results are folded on the
+/// calling thread. `f` must be associative, since the grouping of operations depends on
+/// the split. Returns `None` for empty input. The first error aborts the reduction.
+/// ```
+/// use giacrs::gen::Gen;
+/// use giacrs::parallel::par_reduce;
+///
+/// let inputs: Vec<Gen> = (1..=100).map(Gen::from).collect();
+/// let sum = par_reduce(&inputs, 0, |a, b, _ctx| Ok(a + &b))?.unwrap();
+///
+/// assert_eq!(5050, sum.to_int()?);
+/// # use giacrs::GiacError;
+/// # Ok::<(), GiacError>(())
+/// ```
+pub fn par_reduce<F>(inputs: &[Gen], threads: usize, f: F) -> Result<Option<Gen>, GiacError>
+where
+    F: Fn(Gen, Gen, &Context) -> Result<Gen, GiacError> + Sync,
+{
+    if inputs.is_empty() {
+        return Ok(None);
+    }
+    let threads = resolve_threads(threads, inputs.len());
+    let chunks = split_chunks(inputs, threads);
+    // A partial result only ever shared payloads with gens of its own worker, which are
+    // gone by the time the join synchronizes, so handing it back as a SendRef is sound.
+    let partials: Vec<Result<SendRef, GiacError>> = std::thread::scope(|s| {
+        let handles: Vec<_> = chunks
+            .into_iter()
+            .map(|chunk| {
+                let f = &f;
+                s.spawn(move || {
+                    let ctx = Context::checkout();
+                    let mut it = chunk.into_iter();
+                    let mut acc = it.next().expect("chunks are never empty").into_gen();
+                    for g in it {
+                        acc = f(acc, g.into_gen(), &ctx)?;
+                    }
+                    Ok(SendRef::from_owned(acc))
+                })
+            })
+            .collect();
+        handles.into_iter().map(|h| h.join().unwrap()).collect()
+    });
+    let ctx = Context::checkout();
+    let mut it = partials.into_iter();
+    let mut acc = it.next().expect("inputs are not empty")?.into_gen();
+    for g in it {
+        acc = f(acc, g?.into_gen(), &ctx)?;
+    }
+    Ok(Some(acc))
+}
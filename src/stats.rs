@@ -0,0 +1,53 @@
+//! Memory and allocation instrumentation
+//!
+//! Long-lived services need visibility into the wrapper's allocations for capacity planning
+//! and leak hunting. The cpp side keeps cheap atomic counters on every gen/string allocation
+//! path; [snapshot] polls them in one FFI call.
+
+use crate::ffi;
+
+/// A snapshot of the wrapper's allocation counters. Field order matches the cpp
+/// `giacrs_stats` struct in wrapper/stats.hpp.
+#[repr(C)]
+#[derive(Debug, Default, Clone, Copy, PartialEq, Eq)]
+pub struct GiacStats {
+    /// Gens handed out through the wrapper allocation entry points
+    pub gens_allocated: u64,
+    /// Gens returned through `giacrs_free_gen`
+    pub gens_freed: u64,
+    /// High-water mark of simultaneously live gens
+    pub gens_peak: u64,
+    /// C strings allocated for error messages and stringification
+    pub strings_allocated: u64,
+    /// C strings released through `giacrs_free_str`
+    pub strings_freed: u64,
+    /// Lookups answered by the memoization cache, see [crate::memo]
+    pub memo_hits: u64,
+    /// Lookups the memoization cache could not answer
+    pub memo_misses: u64,
+}
+
+impl GiacStats {
+    /// Gens currently alive (allocated and not yet freed)
+    pub fn live_gens(&self) -> u64 {
+        self.gens_allocated - self.gens_freed
+    }
+}
+
+/// Polls the wrapper's allocation counters.
+/// ```
+/// use giacrs::gen::Gen;
+/// use giacrs::stats;
+///
+/// let before = stats::snapshot();
+/// let a = Gen::from(42);
+/// let after = stats::snapshot();
+///
+/// assert!(after.gens_allocated > before.gens_allocated);
+/// # drop(a);
+/// ```
+pub fn snapshot() -> GiacStats {
+    let mut stats = GiacStats::default();
+    unsafe { ffi::giacrs_stats_snapshot(&mut stats) };
+    stats
+}
@@ -15,6 +15,20 @@ pub enum GiacError {
     InternalError(GiacString),
     /// Equation don't have any solutions
     NoSolution(&'static str),
+    /// Evaluation was stopped by a timeout ([crate::gen::Gen::eval_timeout]) or an explicit
+    /// [crate::interrupt] call
+    Interrupted,
+}
+
+/// Raises giac's interruption flags, from any thread. Interrupted calls return
+/// [GiacError::Interrupted]. This is the only way to stop a pathological computation
+/// without a deadline (see [crate::gen::Gen::eval_timeout]).
+///
+/// The flags are **process-wide**: every giac evaluation currently running is aborted, not
+/// a specific one — including workers of [crate::parallel] or
+/// [crate::integers::ifactors_batch]. There is no way to target a single evaluation.
+pub fn interrupt() {
+    unsafe { ffi::giacrs_interrupt() };
 }
 
 /// Represents all string created from giac. You should use this type if possible to avoid a copy, as a conversion to a rust string needs to copy the entire string.
@@ -23,6 +37,11 @@ pub struct GiacString {
     pub(crate) ptr: *const c_char,
 }
 
+// A GiacString exclusively owns a malloc'd buffer that giac never touches again, and
+// freeing it is thread-safe, so it can move between threads (needed to return errors from
+// the workers in [crate::parallel]).
+unsafe impl Send for GiacString {}
+
 impl GiacString {
     pub(crate) unsafe fn new(ptr: *const c_char) -> Self {
         GiacString { ptr }
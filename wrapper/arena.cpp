@@ -0,0 +1,39 @@
+#include "arena.hpp"
+
+// Gens are allocated in fixed-size blocks; a block is never returned to the
+// system before the whole arena is freed, so allocating a gen is a pointer
+// bump instead of a malloc. Gens obtained from an arena must NOT be passed to
+// giacrs_free_gen, they are all freed at once by giacrs_arena_free.
+#define GIACRS_ARENA_BLOCK 256
+
+struct giacrs_arena {
+    std::vector<giac::gen *> blocks;
+    size_t used; // gens used in the last block
+};
+
+extern "C" giacrs_arena *giacrs_arena_new() {
+    giacrs_arena *a = new giacrs_arena();
+    a->used = GIACRS_ARENA_BLOCK;
+    return a;
+}
+
+extern "C" giac::gen *giacrs_arena_allocate(giacrs_arena *a) {
+    if (a->used == GIACRS_ARENA_BLOCK) {
+        a->blocks.push_back(new giac::gen[GIACRS_ARENA_BLOCK]);
+        a->used = 0;
+    }
+    return &a->blocks.back()[a->used++];
+}
+
+extern "C" giac::gen *giacrs_arena_from_int(giacrs_arena *a, int i) {
+    giac::gen *g = giacrs_arena_allocate(a);
+    *g = giac::gen(i);
+    return g;
+}
+
+extern "C" void giacrs_arena_free(giacrs_arena *a) {
+    for (size_t i = 0; i < a->blocks.size(); i++) {
+        delete[] a->blocks[i];
+    }
+    delete a;
+}
@@ -0,0 +1,4 @@
+#include <giac/config.h>
+#include <giac/giac.h>
+#include <giac/global.h>
+#include <vector>
@@ -0,0 +1,51 @@
+#include "compiled.hpp"
+#include "utils.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+// A compiled expression: the template is parsed once, then every call
+// substitutes the parameter slots (giac::subst) and evaluates, without ever
+// re-entering the parser.
+struct giacrs_compiled {
+    giac::gen expr;
+    giac::vecteur params;
+};
+
+extern "C" result giacrs_compiled_new(char *s, const char **params,
+                                      size_t nparams, giacrs_compiled **out,
+                                      const giac::context *ctx) {
+    SAFE_VOID_CALL({
+        giac::gen expr(s, ctx);
+        if (giac::first_error_line(ctx) != 0) {
+            return string_to_c(giac::parser_error(ctx));
+        }
+        giacrs_compiled *c = new giacrs_compiled();
+        c->expr = expr;
+        c->params.reserve(nparams);
+        for (size_t i = 0; i < nparams; i++) {
+            c->params.push_back(
+                giac::gen(giac::identificateur(std::string(params[i]))));
+        }
+        *out = c;
+    })
+}
+
+extern "C" result giacrs_compiled_call(giacrs_compiled *c, giac::gen **args,
+                                       size_t nargs, giac::gen *res,
+                                       const giac::context *ctx) {
+    SAFE_VOID_CALL({
+        if (nargs != c->params.size()) {
+            throw std::runtime_error(
+                "Wrong number of arguments for compiled expression");
+        }
+        giac::vecteur vals(nargs);
+        for (size_t i = 0; i < nargs; i++) {
+            vals[i] = *args[i];
+        }
+        *res =
+            giac::eval(giac::subst(c->expr, c->params, vals, false, ctx), ctx);
+    })
+}
+
+extern "C" void giacrs_compiled_free(giacrs_compiled *c) { delete c; }
@@ -0,0 +1,5 @@
+#include <giac/config.h>
+#include <giac/giac.h>
+#include <giac/global.h>
+#include <giac/identificateur.h>
+#include <giac/subst.h>
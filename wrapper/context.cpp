@@ -1,17 +1,92 @@
 #include "context.hpp"
+#include "utils.hpp"
 #include <giac/global.h>
+#include <mutex>
+#include <vector>
 
-const giac::context *giacrs_global_context = giac::context0;
+// The global context is fetched lazily: giac::context0 and the logger
+// redirection are only touched on first use, so processes that never need
+// the shared context (or only do native arithmetic) skip the cost at
+// startup entirely.
+static std::once_flag giacrs_global_context_once;
 
-extern "C" void giacrs_init_global_context() {
-    giac::logptr(&nullStream, giac::context0);
+extern "C" const giac::context *giacrs_get_global_context() {
+    std::call_once(giacrs_global_context_once,
+                   [] { giac::logptr(&nullStream, giac::context0); });
+    return giac::context0;
 }
 
+extern "C" void giacrs_warmup() {
+    // Forces giac's lazily-built parser and evaluation tables through a
+    // trivial round trip, so long-lived services can pay the first-eval
+    // cost eagerly instead of on their first request.
+    const giac::context *ctx = giacrs_get_global_context();
+    giac::gen g(std::string("1+1"), ctx);
+    giac::eval(g, 1, ctx);
+}
+
+// Option defaults of a pristine context, captured on the first construction
+// so giacrs_context_reset can restore them without hardcoding giac's values.
+static std::once_flag giacrs_context_defaults_once;
+static double giacrs_default_epsilon;
+static double giacrs_default_proba_epsilon;
+
 extern "C" const giac::context *giacrs_new_context() {
     giac::context *c = new giac::context();
     giac::logptr(&nullStream, c);
+    std::call_once(giacrs_context_defaults_once, [c] {
+        giacrs_default_epsilon = giac::epsilon(c);
+        giacrs_default_proba_epsilon = giac::proba_epsilon(c);
+    });
     return c;
 }
 extern "C" void giacrs_free_context(const giac::context *ctx) { delete ctx; }
 
 extern "C" void giacrs_release_globals() { giac::release_globals(); }
+
+// CONTEXT POOL
+// Constructing a giac::context initializes a lot of global state, which is
+// far too slow when a fresh context is needed per session. The pool keeps
+// released contexts alive (with their user variables cleared) so a checkout
+// on the hot path is a pointer pop instead of a full construction.
+
+static std::vector<const giac::context *> giacrs_context_pool;
+static std::mutex giacrs_context_pool_mutex;
+
+extern "C" void giacrs_context_reset(const giac::context *ctx) {
+    // Clears the user variables without reconstructing the whole context,
+    // and restores the options a session can mutate (epsilon,
+    // proba_epsilon) so e.g. Monte Carlo paths enabled by one pool user
+    // don't silently weaken the guarantees of the next one.
+    giac::context *c = (giac::context *)ctx;
+    if (c->tabptr) {
+        c->tabptr->clear();
+    }
+    giac::epsilon(giacrs_default_epsilon, c);
+    giac::proba_epsilon(ctx) = giacrs_default_proba_epsilon;
+}
+
+extern "C" const giac::context *giacrs_context_checkout() {
+    {
+        std::lock_guard<std::mutex> lock(giacrs_context_pool_mutex);
+        if (!giacrs_context_pool.empty()) {
+            const giac::context *c = giacrs_context_pool.back();
+            giacrs_context_pool.pop_back();
+            return c;
+        }
+    }
+    return giacrs_new_context();
+}
+
+extern "C" void giacrs_context_release(const giac::context *ctx) {
+    giacrs_context_reset(ctx);
+    std::lock_guard<std::mutex> lock(giacrs_context_pool_mutex);
+    giacrs_context_pool.push_back(ctx);
+}
+
+extern "C" void giacrs_context_pool_reserve(size_t n) {
+    std::lock_guard<std::mutex> lock(giacrs_context_pool_mutex);
+    while (giacrs_context_pool.size() < n) {
+        giacrs_context_pool.push_back(giacrs_new_context());
+    }
+}
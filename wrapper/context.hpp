@@ -1,7 +1,11 @@
-#include "utils.hpp"
 #include <giac/config.h>
 #include <giac/giac.h>
 #include <giac/global.h>
 #include <giac/subst.h>
 #include <giac/sym2poly.h>
 #include <giac/vecteur.h>
+
+extern "C" const giac::context *giacrs_new_context();
+extern "C" void giacrs_free_context(const giac::context *ctx);
+extern "C" const giac::context *giacrs_context_checkout();
+extern "C" void giacrs_context_release(const giac::context *ctx);
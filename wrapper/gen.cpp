@@ -1,7 +1,14 @@
 #include "gen.hpp"
+#include "memo.hpp"
+#include "stats.hpp"
 #include "utils.hpp"
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
 #include <cstdint>
 #include <cstring>
+#include <mutex>
+#include <thread>
 #include <giac/config.h>
 #include <giac/gausspol.h>
 #include <giac/gen.h>
@@ -16,9 +23,12 @@
 #include <giac/sym2poly.h>
 #include <giac/usual.h>
 #include <giac/vecteur.h>
+#include <sstream>
 #include <stdexcept>
+#include <vector>
 
 char *string_to_c(std::string s) {
+    giacrs_stat_strings_allocated.fetch_add(1, std::memory_order_relaxed);
     char *str = (char *)malloc((s.length() + 1) * sizeof(char));
     std::strcpy(str, s.c_str());
     return str;
@@ -26,7 +36,40 @@ char *string_to_c(std::string s) {
 
 // ALLOCATION
 
-extern "C" giac::gen *giacrs_gen_allocate() { return new giac::gen(); }
+// giac stores _INT_ values inline in the gen, so the only cost of a
+// small-integer Gen is the heap allocation of the gen box itself and the
+// later free call. A bounded thread-local cache of gen shells removes the
+// malloc/free pair from that hot path: freed gens have their payload
+// released and their shell kept for reuse. Promotion to big numbers is
+// transparent since the handles stay ordinary giac::gen pointers.
+#define GIACRS_SHELL_CACHE_SIZE 1024
+
+// The holder's destructor runs at thread exit and deletes whatever shells
+// are still cached, so short-lived threads (e.g. the workers the parallel
+// module spawns per call) don't leak up to a cache's worth of gen boxes
+// each time one exits.
+struct giacrs_shell_cache_t {
+    std::vector<giac::gen *> shells;
+    ~giacrs_shell_cache_t() {
+        for (giac::gen *g : shells) {
+            delete g;
+        }
+    }
+};
+
+static thread_local giacrs_shell_cache_t giacrs_shell_cache;
+
+static giac::gen *giacrs_gen_shell() {
+    giacrs_stat_gen_allocated();
+    if (!giacrs_shell_cache.shells.empty()) {
+        giac::gen *g = giacrs_shell_cache.shells.back();
+        giacrs_shell_cache.shells.pop_back();
+        return g;
+    }
+    return new giac::gen();
+}
+
+extern "C" giac::gen *giacrs_gen_allocate() { return giacrs_gen_shell(); }
 extern "C" result giacrs_gen_from_str(char *s, const giac::context *ctx,
                                       giac::gen *res) {
     *res = giac::gen(s, ctx);
@@ -37,22 +80,200 @@ extern "C" result giacrs_gen_from_str(char *s, const giac::context *ctx,
     SAFE_CALL(giac::eval(*res, ctx))
 }
 
-extern "C" giac::gen *giacrs_gen_from_int(int i) { return new giac::gen(i); }
+// Errcode variant of giacrs_gen_from_str: parse and domain errors are
+// expected and frequent in some workloads, and the `result` convention
+// mallocs a message for each of them. Returns 0 on success; on failure the
+// message is in the thread-local error slot (see utils.cpp).
+extern "C" errcode giacrs_gen_from_str_code(char *s, const giac::context *ctx,
+                                            giac::gen *res) {
+    *res = giac::gen(s, ctx);
+    if (giac::first_error_line(ctx) != 0) {
+        giacrs_store_error(giac::parser_error(ctx).c_str());
+        return 1;
+    }
+    // Evaluate expression
+    SAFE_CALL_CODE(giac::eval(*res, ctx))
+}
+
+extern "C" void giacrs_gen_from_str_multi(const char **srcs, size_t len,
+                                          giac::gen **res, result *statuses,
+                                          bool do_eval,
+                                          const giac::context *ctx) {
+    // Parses a whole worksheet of expressions in one FFI crossing and one
+    // parser session. Evaluation is optional: loading often only needs the
+    // parse trees. Errors are per expression so one bad line does not abort
+    // the rest of the load.
+    for (size_t i = 0; i < len; i++) {
+        try {
+            giac::first_error_line(0, ctx);
+            *res[i] = giac::gen(std::string(srcs[i]), ctx);
+            if (giac::first_error_line(ctx) != 0) {
+                statuses[i] = string_to_c(giac::parser_error(ctx));
+                continue;
+            }
+            if (do_eval) {
+                *res[i] = giac::eval(*res[i], ctx);
+            }
+            statuses[i] = NULL;
+        } catch (std::runtime_error &e) {
+            statuses[i] = string_to_c(e.what());
+        }
+    }
+}
+
+extern "C" void giacrs_gen_eval_batch(giac::gen **exprs, giac::gen **res,
+                                      result *statuses, size_t len,
+                                      const giac::context *ctx) {
+    // A single FFI crossing for the whole batch, one try/catch frame per
+    // element so an error on one expression does not abort the others.
+    for (size_t i = 0; i < len; i++) {
+        try {
+            *res[i] = giac::eval(*exprs[i], ctx);
+            statuses[i] = NULL;
+        } catch (std::runtime_error &e) {
+            statuses[i] = string_to_c(e.what());
+        }
+    }
+}
+
+extern "C" giac::gen *giacrs_gen_from_int(int i) {
+    giac::gen *g = giacrs_gen_shell();
+    *g = giac::gen(i);
+    return g;
+}
 extern "C" giac::gen *giacrs_gen_from_float(float i) {
+    giacrs_stat_gen_allocated();
     return new giac::gen(i);
 }
 extern "C" giac::gen *giacrs_gen_from_double(double i) {
+    giacrs_stat_gen_allocated();
     return new giac::gen(i);
 }
 
 extern "C" giac::gen *giacrs_gen_factorial(unsigned long i) {
+    giacrs_stat_gen_allocated();
     return new giac::gen(giac::factorial(i));
 }
 
-extern "C" void giacrs_free_gen(giac::gen *e) { delete e; }
+extern "C" void giacrs_free_gen(giac::gen *e) {
+    giacrs_stat_gen_freed();
+    if (giacrs_shell_cache.shells.size() < GIACRS_SHELL_CACHE_SIZE) {
+        // Release any heavy payload now, keep the shell for reuse
+        *e = giac::gen();
+        giacrs_shell_cache.shells.push_back(e);
+        return;
+    }
+    delete e;
+}
+
+// giac's reference counts are plain non-atomic ints, so two gens sharing a
+// payload must never be touched from different threads. A deep copy shares
+// nothing with its source: it is the only form in which a gen may cross a
+// thread boundary (see src/parallel.rs) or live in a shared cache (memo.cpp).
+giac::gen giacrs_deep_copy(const giac::gen &g) {
+    switch (g.type) {
+    case giac::_INT_:
+    case giac::_DOUBLE_:
+    case giac::_FLOAT_:
+        // stored inline in the gen, nothing shared
+        return g;
+    case giac::_FUNC:
+        // points at a static unary_function_ptr, not refcounted
+        return g;
+    case giac::_ZINT:
+        return giac::gen(*g._ZINTptr);
+    case giac::_CPLX:
+        return giac::gen(giacrs_deep_copy(*g._CPLXptr),
+                         giacrs_deep_copy(*(g._CPLXptr + 1)));
+    case giac::_FRAC:
+        return giac::fraction(giacrs_deep_copy(g._FRACptr->num),
+                              giacrs_deep_copy(g._FRACptr->den));
+    case giac::_STRNG:
+        return giac::string2gen(*g._STRNGptr, false);
+    case giac::_IDNT:
+        // identifiers compare by name, a fresh one is interchangeable
+        return giac::gen(giac::identificateur(g._IDNTptr->id_name));
+    case giac::_VECT: {
+        giac::vecteur v;
+        v.reserve(g._VECTptr->size());
+        for (const giac::gen &x : *g._VECTptr) {
+            v.push_back(giacrs_deep_copy(x));
+        }
+        return giac::gen(v, g.subtype);
+    }
+    case giac::_SYMB:
+        return giac::symbolic(g._SYMBptr->sommet,
+                              giacrs_deep_copy(g._SYMBptr->feuille));
+    default: {
+        // Exotic types (maps, sparse polynomials, ...) are rebuilt from
+        // scratch through an archive round trip.
+        std::ostringstream os;
+        giac::archive(os, g, giac::context0);
+        std::istringstream is(os.str());
+        return giac::unarchive(is, giac::context0);
+    }
+    }
+}
+
+extern "C" giac::gen *giacrs_gen_deep_copy(giac::gen *e) {
+    giac::gen *g = giacrs_gen_shell();
+    *g = giacrs_deep_copy(*e);
+    return g;
+}
+
+extern "C" void giacrs_free_gen_batch(giac::gen **es, size_t len) {
+    // One FFI crossing for a whole teardown instead of one per gen; goes
+    // through giacrs_free_gen so the shells are recycled the same way.
+    for (size_t i = 0; i < len; i++) {
+        giacrs_free_gen(es[i]);
+    }
+}
 
 extern "C" giac::gen *giacrs_gen_clone(giac::gen *e) {
-    return new giac::gen(*e);
+    // giac::gen's copy assignment only bumps the refcount of heavy payloads
+    // (_ZINT, _VECT, _SYMB, ...), so a clone is shallow already; taking the
+    // box from the shell cache makes it allocation-free too.
+    giac::gen *g = giacrs_gen_shell();
+    *g = *e;
+    return g;
+}
+
+// SYMBOLS
+
+// Building expression trees programmatically should not pay for a parser
+// pass per symbol. Identifier gens are built straight from the name, one
+// fresh identificateur per call: giac compares identifiers by name and
+// binds them through the context table, so nothing is gained by sharing
+// one backing object — and sharing would mean its non-atomic refcount gets
+// mutated from whatever thread later drops the gen. A shared interning
+// table would also pin every unique name for the process lifetime.
+extern "C" giac::gen *giacrs_gen_ident(const char *name) {
+    giac::gen *g = giacrs_gen_shell();
+    *g = giac::gen(giac::identificateur(name));
+    return g;
+}
+
+extern "C" result giacrs_gen_apply(giac::gen *f, giac::gen **args, size_t len,
+                                   giac::gen *res) {
+    // Builds the symbolic application f(args...) as a tree, without
+    // evaluating it and without the parser.
+    SAFE_VOID_CALL({
+        giac::gen a;
+        if (len == 1) {
+            a = *args[0];
+        } else {
+            giac::vecteur v(len);
+            for (size_t i = 0; i < len; i++) {
+                v[i] = *args[i];
+            }
+            a = giac::gen(v, giac::_SEQ__VECT);
+        }
+        if (f->type == giac::_FUNC) {
+            *res = giac::symbolic(*f->_FUNCptr, a);
+        } else {
+            *res = giac::symb_of(*f, a);
+        }
+    })
 }
 
 // DATA
@@ -63,16 +284,228 @@ extern "C" result giacrs_gen_is_zero(giac::gen *e, bool *res,
     SAFE_CALL(giac::is_zero(*e, ctx));
 }
 
+// Unchecked fast paths: no try/catch frame, no context, direct field reads.
+// These never throw, but are only meaningful on gens whose type the caller
+// has already checked with giacrs_gen_type (_INT_ unless noted).
+extern "C" int giacrs_gen_to_int_unchecked(giac::gen *e) { return e->val; }
+extern "C" bool giacrs_gen_is_zero_unchecked(giac::gen *e) {
+    return e->val == 0;
+}
+extern "C" bool giacrs_gen_even_unchecked(giac::gen *e) {
+    return (e->val & 1) == 0;
+}
+extern "C" int8_t giacrs_gen_sign_unchecked(giac::gen *e) {
+    return (e->val > 0) - (e->val < 0);
+}
+extern "C" bool giacrs_gen_is_integer(giac::gen *e) {
+    return e->type == giac::_INT_ || e->type == giac::_ZINT;
+}
+
 // CONVERSION
 
+// Raw byte interchange for big integers: a _ZINT gen crosses the boundary
+// as its little-endian magnitude bytes (mpz_export/mpz_import) plus a sign,
+// one linear copy instead of a print-to-decimal/re-parse round trip that is
+// quadratic in the size of the number. _INT_ values take a manual fast path
+// so callers don't need to care which representation giac chose.
+
+extern "C" result giacrs_gen_byte_size(giac::gen *e, size_t *res) {
+    SAFE_VOID_CALL({
+        if (e->type == giac::_INT_) {
+            unsigned v = e->val < 0 ? -(unsigned)e->val : (unsigned)e->val;
+            size_t n = 0;
+            while (v != 0) {
+                n++;
+                v >>= 8;
+            }
+            *res = n;
+        } else if (e->type == giac::_ZINT) {
+            if (mpz_sgn(*e->_ZINTptr) == 0) {
+                *res = 0;
+            } else {
+                *res = (mpz_sizeinbase(*e->_ZINTptr, 2) + 7) / 8;
+            }
+        } else {
+            throw std::runtime_error("Expression is not an integer");
+        }
+    })
+}
+
+extern "C" result giacrs_gen_to_bytes(giac::gen *e, uint8_t *out,
+                                      int8_t *sign) {
+    // out must hold giacrs_gen_byte_size bytes; filled little-endian
+    SAFE_VOID_CALL({
+        if (e->type == giac::_INT_) {
+            *sign = (e->val > 0) - (e->val < 0);
+            unsigned v = e->val < 0 ? -(unsigned)e->val : (unsigned)e->val;
+            for (size_t i = 0; v != 0; i++, v >>= 8) {
+                out[i] = (uint8_t)(v & 0xff);
+            }
+        } else if (e->type == giac::_ZINT) {
+            *sign = (int8_t)mpz_sgn(*e->_ZINTptr);
+            if (*sign != 0) {
+                size_t count;
+                mpz_export(out, &count, -1, 1, 0, 0, *e->_ZINTptr);
+            }
+        } else {
+            throw std::runtime_error("Expression is not an integer");
+        }
+    })
+}
+
+extern "C" giac::gen *giacrs_gen_from_bytes(const uint8_t *data, size_t len,
+                                            int8_t sign) {
+    giac::gen *g = giacrs_gen_shell();
+    mpz_t z;
+    mpz_init(z);
+    if (len != 0 && sign != 0) {
+        mpz_import(z, len, -1, 1, 0, 0, data);
+        if (sign < 0) {
+            mpz_neg(z, z);
+        }
+    }
+    *g = giac::gen(z);
+    mpz_clear(z);
+    return g;
+}
+
 extern "C" const char *giacrs_gen_to_str(giac::gen *e) {
     return string_to_c(e->print());
 }
 
+extern "C" void giacrs_gen_print_with(giac::gen *e,
+                                      void (*writer)(void *data,
+                                                     const char *bytes,
+                                                     size_t len),
+                                      void *data) {
+    // Streams print() output straight into a caller-owned buffer, avoiding
+    // the malloc+strcpy of string_to_c and the later giacrs_free_str call.
+    std::string s = e->print();
+    writer(data, s.data(), s.length());
+}
+
+// Chunked variant of giacrs_gen_print_with: the textual form is handed to
+// the sink in pieces of at most chunk_size bytes, so the caller can stream
+// it to a file or refill a fixed buffer without ever holding the whole
+// output on its side. giac's print() itself still materializes one
+// std::string; this bounds everything the wrapper adds on top of it.
+extern "C" void giacrs_gen_print_chunked(giac::gen *e, size_t chunk_size,
+                                         void (*writer)(void *data,
+                                                        const char *bytes,
+                                                        size_t len),
+                                         void *data) {
+    std::string s = e->print();
+    if (chunk_size == 0) {
+        chunk_size = s.length() ? s.length() : 1;
+    }
+    for (size_t off = 0; off < s.length(); off += chunk_size) {
+        size_t n = s.length() - off;
+        if (n > chunk_size) {
+            n = chunk_size;
+        }
+        writer(data, s.data() + off, n);
+    }
+}
+
 extern "C" result giacrs_gen_to_int(giac::gen *e, int *res) {
     SAFE_CALL(e->to_int());
 }
 
+// INTERRUPTION
+
+// giac polls its global ctrl_c/interrupted flags during evaluation and
+// throws when they are set; this is the supported way to stop a runaway
+// computation.
+extern "C" void giacrs_interrupt() {
+    giac::ctrl_c = true;
+    giac::interrupted = true;
+}
+
+// Evaluates with a deadline: a watchdog thread raises the interruption
+// flags once `seconds` have elapsed, so one pathological expression cannot
+// spin forever. *interrupted tells the caller the failure was a timeout or
+// an explicit giacrs_interrupt, not a giac error.
+//
+// The flags are process-wide, so timeout-bounded evals are serialized on a
+// mutex: a deadline expiring here must never abort an unrelated evaluation
+// running on another thread. Evaluations outside this entry point are
+// still exposed to the flags; that blast radius is documented on the Rust
+// side.
+static std::mutex giacrs_eval_timeout_mutex;
+
+extern "C" result giacrs_gen_eval_timeout(giac::gen *e, giac::gen *res,
+                                          double seconds, bool *interrupted,
+                                          const giac::context *ctx) {
+    std::lock_guard<std::mutex> serial(giacrs_eval_timeout_mutex);
+    std::mutex m;
+    std::condition_variable cv;
+    bool done = false;
+    bool fired = false;
+    std::thread watchdog([&]() {
+        std::unique_lock<std::mutex> lock(m);
+        if (!cv.wait_for(lock, std::chrono::duration<double>(seconds),
+                         [&]() { return done; })) {
+            fired = true;
+            giacrs_interrupt();
+        }
+    });
+    result r;
+    bool threw = false;
+    try {
+        *res = giac::eval(*e, ctx);
+        r = NULL;
+    } catch (std::runtime_error &err) {
+        threw = true;
+        r = string_to_c(err.what());
+    } catch (...) {
+        threw = true;
+        r = string_to_c("Evaluation interrupted");
+    }
+    {
+        std::lock_guard<std::mutex> lock(m);
+        done = true;
+    }
+    cv.notify_all();
+    watchdog.join();
+    // If eval returned normally the result is valid even when the deadline
+    // fired in its final instants — don't discard it as interrupted. Only
+    // clear the flags when they were actually raised, so a quiet completion
+    // doesn't touch global state at all.
+    *interrupted = threw && (fired || giac::interrupted || giac::ctrl_c);
+    if (fired || giac::interrupted || giac::ctrl_c) {
+        giac::interrupted = false;
+        giac::ctrl_c = false;
+    }
+    return r;
+}
+
+// SERIALIZATION
+
+extern "C" result giacrs_gen_archive(giac::gen *e, char **buf, size_t *len,
+                                     const giac::context *ctx) {
+    // Binary format from giac's archive machinery, reloadable without
+    // touching the parser. The buffer must be freed with giacrs_free_str.
+    SAFE_VOID_CALL({
+        std::ostringstream os;
+        giac::archive(os, *e, ctx);
+        std::string s = os.str();
+        giacrs_stat_strings_allocated.fetch_add(1, std::memory_order_relaxed);
+        *len = s.length();
+        *buf = (char *)malloc(*len);
+        std::memcpy(*buf, s.data(), *len);
+    });
+}
+
+extern "C" result giacrs_gen_unarchive(const char *buf, size_t len,
+                                       giac::gen *res,
+                                       const giac::context *ctx) {
+    SAFE_VOID_CALL({
+        std::string s(buf, len);
+        std::istringstream is(s);
+        *res = giac::unarchive(is, ctx);
+    });
+}
+
 // METHODS
 
 extern "C" result giacrs_gen_gcd(giac::gen *a, giac::gen *b, giac::gen *res,
@@ -84,6 +517,35 @@ extern "C" result giacrs_gen_lcm(giac::gen *a, giac::gen *b, giac::gen *res) {
     SAFE_CALL(giac::lcm(*a, *b));
 }
 
+// N-ary reductions: folding gcd/lcm over an array inside one call avoids an
+// FFI round trip and a temporary gen per element. gcd exits early once the
+// accumulator reaches 1, which for typical coefficient vectors happens
+// after a handful of elements.
+extern "C" result giacrs_gen_gcd_n(giac::gen **xs, size_t len, giac::gen *res,
+                                   const giac::context *ctx) {
+    SAFE_VOID_CALL({
+        giac::gen acc(0);
+        for (size_t i = 0; i < len; i++) {
+            acc = giac::gcd(acc, *xs[i], ctx);
+            if (giac::is_one(acc)) {
+                break;
+            }
+        }
+        *res = acc;
+    })
+}
+
+extern "C" result giacrs_gen_lcm_n(giac::gen **xs, size_t len,
+                                   giac::gen *res) {
+    SAFE_VOID_CALL({
+        giac::gen acc(1);
+        for (size_t i = 0; i < len; i++) {
+            acc = giac::lcm(acc, *xs[i]);
+        }
+        *res = acc;
+    })
+}
+
 extern "C" result giacrs_gen_ifactor(giac::gen *e, giac::gen *res,
                                      const giac::context *ctx) {
     SAFE_CALL(giac::_ifactor(*e, ctx));
@@ -91,7 +553,13 @@ extern "C" result giacrs_gen_ifactor(giac::gen *e, giac::gen *res,
 
 extern "C" result giacrs_gen_ifactors(giac::gen *e, giac::gen *res,
                                       const giac::context *ctx) {
-    SAFE_CALL(giac::_ifactors(*e, ctx));
+    if (giacrs_memo_lookup('i', *e, *res)) {
+        return NULL;
+    }
+    SAFE_VOID_CALL({
+        *res = giac::_ifactors(*e, ctx);
+        giacrs_memo_store('i', *e, *res);
+    })
 }
 
 extern "C" result giacrs_gen_maple_ifactors(giac::gen *e, giac::gen *res,
@@ -118,6 +586,35 @@ extern "C" result giacrs_gen_irem(giac::gen *a, giac::gen *b, giac::gen *res) {
     return giacrs_gen_iquorem(a, b, &q, res);
 }
 
+// Batched reduction by a fixed modulus, writing results in place. For a
+// modulus and inputs that are machine integers each element costs one
+// integer division; everything else falls back to giac::irem. This turns a
+// CRT reduction pass over millions of values into one FFI call.
+extern "C" result giacrs_gen_irem_batch(giac::gen **xs, size_t len,
+                                        giac::gen *m) {
+    SAFE_VOID_CALL({
+        // mv == -1 is excluded from the fast path: INT_MIN % -1 overflows
+        // (UB, SIGFPE on x86), so that pair goes through giac::irem.
+        if (m->type == giac::_INT_ && m->val != 0 && m->val != -1) {
+            int mv = m->val;
+            for (size_t i = 0; i < len; i++) {
+                giac::gen *x = xs[i];
+                if (x->type == giac::_INT_) {
+                    x->val %= mv;
+                    continue;
+                }
+                giac::gen q;
+                *x = giac::irem(*x, *m, q);
+            }
+        } else {
+            for (size_t i = 0; i < len; i++) {
+                giac::gen q;
+                *xs[i] = giac::irem(*xs[i], *m, q);
+            }
+        }
+    })
+}
+
 extern "C" result giacrs_gen_even(giac::gen *a, bool *res, giac::context *ctx) {
     SAFE_CALL(!giac::is_zero(giac::_even(*a, ctx)));
 }
@@ -126,6 +623,67 @@ extern "C" result giacrs_gen_odd(giac::gen *a, bool *res, giac::context *ctx) {
     SAFE_CALL(!giac::is_zero(giac::_odd(*a, ctx)));
 }
 
+// BATCHED PREDICATES
+// Filtering passes over multi-million-element arrays cost one FFI call and
+// a linear scan. The inner loops branch only on the gen type: _INT_ elements
+// are answered with a direct field read, everything else falls back to the
+// giac predicate the scalar entry points use.
+
+extern "C" result giacrs_gen_is_zero_batch(giac::gen **es, size_t len,
+                                           uint8_t *out,
+                                           const giac::context *ctx) {
+    SAFE_VOID_CALL({
+        for (size_t i = 0; i < len; i++) {
+            giac::gen *e = es[i];
+            out[i] = e->type == giac::_INT_ ? e->val == 0
+                                            : giac::is_zero(*e, ctx);
+        }
+    })
+}
+
+extern "C" result giacrs_gen_even_batch(giac::gen **es, size_t len,
+                                        uint8_t *out,
+                                        const giac::context *ctx) {
+    SAFE_VOID_CALL({
+        for (size_t i = 0; i < len; i++) {
+            giac::gen *e = es[i];
+            out[i] = e->type == giac::_INT_
+                         ? (e->val & 1) == 0
+                         : !giac::is_zero(giac::_even(*e, ctx));
+        }
+    })
+}
+
+extern "C" result giacrs_gen_odd_batch(giac::gen **es, size_t len,
+                                       uint8_t *out,
+                                       const giac::context *ctx) {
+    SAFE_VOID_CALL({
+        for (size_t i = 0; i < len; i++) {
+            giac::gen *e = es[i];
+            out[i] = e->type == giac::_INT_
+                         ? (e->val & 1) == 1
+                         : !giac::is_zero(giac::_odd(*e, ctx));
+        }
+    })
+}
+
+extern "C" result giacrs_gen_sign_batch(giac::gen **es, size_t len,
+                                        int8_t *out,
+                                        const giac::context *ctx) {
+    SAFE_VOID_CALL({
+        for (size_t i = 0; i < len; i++) {
+            giac::gen *e = es[i];
+            if (e->type == giac::_INT_) {
+                out[i] = (e->val > 0) - (e->val < 0);
+            } else if (giac::is_zero(*e, ctx)) {
+                out[i] = 0;
+            } else {
+                out[i] = giac::is_positive(*e, ctx) ? 1 : -1;
+            }
+        }
+    })
+}
+
 extern "C" result giacrs_gen_is_pseudoprime(giac::gen *a, int8_t *res) {
     SAFE_CALL(giac::is_probab_prime_p(*a));
 }
@@ -138,6 +696,53 @@ extern "C" result giacrs_gen_prevprime(giac::gen *a, giac::gen *res) {
     SAFE_CALL(giac::prevprime(*a));
 }
 
+// Sieves [lo, hi) in one call; out must hold hi-lo bytes, out[i] is set to 1
+// iff lo+i is prime. A segmented sieve keeps memory at O(sqrt(hi)) plus the
+// output, so enumerating primes over a range stops costing one nextprime
+// FFI round trip per candidate.
+extern "C" void giacrs_prime_sieve(uint64_t lo, uint64_t hi,
+                                   unsigned char *out) {
+    if (hi <= lo) {
+        return;
+    }
+    std::memset(out, 1, hi - lo);
+    for (uint64_t i = lo; i < hi && i < 2; i++) {
+        out[i - lo] = 0;
+    }
+    uint64_t root = (uint64_t)std::sqrt((double)hi) + 1;
+    // Sieve the base primes up to sqrt(hi)
+    std::vector<unsigned char> base(root + 1, 1);
+    for (uint64_t p = 2; p * p <= root; p++) {
+        if (base[p]) {
+            for (uint64_t q = p * p; q <= root; q += p) {
+                base[q] = 0;
+            }
+        }
+    }
+    // Cross out their multiples in the segment
+    for (uint64_t p = 2; p <= root; p++) {
+        if (!base[p]) {
+            continue;
+        }
+        uint64_t start = p * p;
+        if (start < lo) {
+            start = ((lo + p - 1) / p) * p;
+        }
+        for (uint64_t q = start; q < hi; q += p) {
+            out[q - lo] = 0;
+        }
+    }
+}
+
+extern "C" result giacrs_gen_is_pseudoprime_batch(giac::gen **xs, size_t len,
+                                                  int8_t *out) {
+    SAFE_VOID_CALL({
+        for (size_t i = 0; i < len; i++) {
+            out[i] = giac::is_probab_prime_p(*xs[i]);
+        }
+    })
+}
+
 extern "C" result giacrs_gen_nthprime(giac::gen *a, giac::gen *res,
                                       giac::context *ctx) {
     try {
@@ -236,16 +841,77 @@ extern "C" result giacrs_gen_div(giac::gen *res, giac::gen *f) {
     SAFE_CALL(*res / *f)
 }
 
+// The generic operators above build a temporary gen and copy-assign it; for
+// machine integers the result can be written directly into *res, skipping
+// the temporary, the copy and the try/catch frame.
+extern "C" result giacrs_gen_add_inplace(giac::gen *res, giac::gen *f) {
+    if (res->type == giac::_INT_ && f->type == giac::_INT_) {
+        long long s = (long long)res->val + (long long)f->val;
+        if (s == (int)s) {
+            res->val = (int)s;
+            return NULL;
+        }
+    }
+    SAFE_VOID_CALL(*res = *res + *f;)
+}
+extern "C" result giacrs_gen_sub_inplace(giac::gen *res, giac::gen *f) {
+    if (res->type == giac::_INT_ && f->type == giac::_INT_) {
+        long long s = (long long)res->val - (long long)f->val;
+        if (s == (int)s) {
+            res->val = (int)s;
+            return NULL;
+        }
+    }
+    SAFE_VOID_CALL(*res = *res - *f;)
+}
+extern "C" result giacrs_gen_mul_inplace(giac::gen *res, giac::gen *f) {
+    if (res->type == giac::_INT_ && f->type == giac::_INT_) {
+        long long p = (long long)res->val * (long long)f->val;
+        if (p == (int)p) {
+            res->val = (int)p;
+            return NULL;
+        }
+    }
+    SAFE_VOID_CALL(*res = *res * *f;)
+}
+
+// Fused multiply-add: *acc += *a * *b in a single call, with no
+// intermediate gen crossing the FFI boundary
+extern "C" result giacrs_gen_fma(giac::gen *acc, giac::gen *a, giac::gen *b) {
+    if (acc->type == giac::_INT_ && a->type == giac::_INT_ &&
+        b->type == giac::_INT_) {
+        long long r =
+            (long long)acc->val + (long long)a->val * (long long)b->val;
+        if (r == (int)r) {
+            acc->val = (int)r;
+            return NULL;
+        }
+    }
+    SAFE_VOID_CALL(*acc = *acc + (*a) * (*b);)
+}
+
 // OTHERS
 
 extern "C" result giacrs_gen_factor(giac::gen *e, giac::gen *res,
                                     const giac::context *ctx) {
-    SAFE_CALL(giac::_factor(*e, ctx));
+    if (giacrs_memo_lookup('f', *e, *res)) {
+        return NULL;
+    }
+    SAFE_VOID_CALL({
+        *res = giac::_factor(*e, ctx);
+        giacrs_memo_store('f', *e, *res);
+    })
 }
 
 extern "C" result giacrs_gen_simplify(giac::gen *e, giac::gen *res,
                                       const giac::context *ctx) {
-    SAFE_CALL(giac::simplify(*e, ctx));
+    if (giacrs_memo_lookup('s', *e, *res)) {
+        return NULL;
+    }
+    SAFE_VOID_CALL({
+        *res = giac::simplify(*e, ctx);
+        giacrs_memo_store('s', *e, *res);
+    })
 }
 
 extern "C" result giacrs_gen_det(giac::gen *e, giac::gen *res,
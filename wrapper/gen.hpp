@@ -4,3 +4,7 @@
 #include <giac/subst.h>
 #include <giac/sym2poly.h>
 #include <giac/vecteur.h>
+
+// Structural deep copy, defined in gen.cpp and shared with memo.cpp: the
+// result shares no reference-counted payload with the source.
+giac::gen giacrs_deep_copy(const giac::gen &g);
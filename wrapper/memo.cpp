@@ -0,0 +1,96 @@
+#include "gen.hpp"
+#include "memo.hpp"
+#include "stats.hpp"
+#include <atomic>
+#include <giac/global.h>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+// Opt-in memoization for the expensive pure transforms (simplify, factor,
+// ifactors). Disabled by default; when enabled it is one bounded LRU shared
+// by the whole process, protected by a mutex — the ops it caches cost orders
+// of magnitude more than the lock. Entries are keyed by an op tag plus the
+// printed form of the input, since giac exposes no stable structural hash
+// for gens; print is linear in the input and the cached ops are not.
+//
+// Gens enter and leave the cache only as deep copies (giacrs_deep_copy):
+// cached entries must not share refcounted payloads with callers, because
+// a returned gen is later dropped on its caller's thread without the cache
+// mutex, and giac's refcounts are not atomic.
+
+static std::atomic<size_t> giacrs_memo_capacity(0);
+static std::mutex giacrs_memo_mutex;
+// Most recently used entries sit at the front; the map points into the list.
+static std::list<std::pair<std::string, giac::gen>> giacrs_memo_lru;
+static std::unordered_map<std::string,
+                          std::list<std::pair<std::string, giac::gen>>::iterator>
+    giacrs_memo_index;
+
+static std::string giacrs_memo_key(char op, const giac::gen &key) {
+    std::string s(1, op);
+    s += ':';
+    s += key.print(giac::context0);
+    return s;
+}
+
+bool giacrs_memo_lookup(char op, const giac::gen &key, giac::gen &out) {
+    if (giacrs_memo_capacity.load(std::memory_order_relaxed) == 0) {
+        return false;
+    }
+    std::string k = giacrs_memo_key(op, key);
+    std::lock_guard<std::mutex> lock(giacrs_memo_mutex);
+    auto it = giacrs_memo_index.find(k);
+    if (it == giacrs_memo_index.end()) {
+        giacrs_stat_memo_misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    giacrs_memo_lru.splice(giacrs_memo_lru.begin(), giacrs_memo_lru,
+                           it->second);
+    out = giacrs_deep_copy(it->second->second);
+    giacrs_stat_memo_hits.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void giacrs_memo_store(char op, const giac::gen &key, const giac::gen &val) {
+    size_t capacity = giacrs_memo_capacity.load(std::memory_order_relaxed);
+    if (capacity == 0) {
+        return;
+    }
+    std::string k = giacrs_memo_key(op, key);
+    std::lock_guard<std::mutex> lock(giacrs_memo_mutex);
+    auto it = giacrs_memo_index.find(k);
+    if (it != giacrs_memo_index.end()) {
+        giacrs_memo_lru.splice(giacrs_memo_lru.begin(), giacrs_memo_lru,
+                               it->second);
+        it->second->second = giacrs_deep_copy(val);
+        return;
+    }
+    giacrs_memo_lru.emplace_front(k, giacrs_deep_copy(val));
+    giacrs_memo_index[k] = giacrs_memo_lru.begin();
+    while (giacrs_memo_lru.size() > capacity) {
+        giacrs_memo_index.erase(giacrs_memo_lru.back().first);
+        giacrs_memo_lru.pop_back();
+    }
+}
+
+extern "C" void giacrs_memo_enable(size_t capacity) {
+    giacrs_memo_capacity.store(capacity, std::memory_order_relaxed);
+    if (capacity == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(giacrs_memo_mutex);
+    while (giacrs_memo_lru.size() > capacity) {
+        giacrs_memo_index.erase(giacrs_memo_lru.back().first);
+        giacrs_memo_lru.pop_back();
+    }
+}
+
+extern "C" void giacrs_memo_disable() {
+    giacrs_memo_capacity.store(0, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(giacrs_memo_mutex);
+    giacrs_memo_index.clear();
+    giacrs_memo_lru.clear();
+}
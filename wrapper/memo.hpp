@@ -0,0 +1,8 @@
+#include <giac/config.h>
+#include <giac/gen.h>
+#include <giac/giac.h>
+
+// Internal lookup/store used by the memoized entry points in gen.cpp; the
+// extern "C" enable/disable surface is in memo.cpp.
+bool giacrs_memo_lookup(char op, const giac::gen &key, giac::gen &out);
+void giacrs_memo_store(char op, const giac::gen &key, const giac::gen &val);
@@ -0,0 +1,177 @@
+#include "numeric.hpp"
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+// Dense double-precision linear-algebra kernels operating on contiguous
+// row-major buffers. For purely numeric matrices this skips boxing every
+// element into a giac::gen and the per-element type dispatch that
+// giac::_det & co. pay; elements never leave the double array.
+
+// In-place LU decomposition with partial pivoting. Returns the permutation
+// sign (+1/-1), fills `piv` with the row swaps, and leaves L (unit diagonal)
+// and U packed in `a`. A zero pivot marks the matrix singular: the caller
+// decides whether that is an error (solve) or an answer (det = 0, rank).
+static int giacrs_dlu(double *a, size_t n, std::vector<size_t> &piv,
+                      bool *singular) {
+    int sign = 1;
+    *singular = false;
+    piv.resize(n);
+    for (size_t k = 0; k < n; k++) {
+        size_t p = k;
+        double best = std::fabs(a[k * n + k]);
+        for (size_t i = k + 1; i < n; i++) {
+            double v = std::fabs(a[i * n + k]);
+            if (v > best) {
+                best = v;
+                p = i;
+            }
+        }
+        piv[k] = p;
+        if (best == 0.0) {
+            *singular = true;
+            continue;
+        }
+        if (p != k) {
+            for (size_t j = 0; j < n; j++) {
+                std::swap(a[k * n + j], a[p * n + j]);
+            }
+            sign = -sign;
+        }
+        double pivot = a[k * n + k];
+        for (size_t i = k + 1; i < n; i++) {
+            double f = a[i * n + k] / pivot;
+            a[i * n + k] = f;
+            for (size_t j = k + 1; j < n; j++) {
+                a[i * n + j] -= f * a[k * n + j];
+            }
+        }
+    }
+    return sign;
+}
+
+extern "C" result giacrs_dmat_det(const double *data, size_t n, double *res) {
+    SAFE_VOID_CALL({
+        std::vector<double> a(data, data + n * n);
+        std::vector<size_t> piv;
+        bool singular;
+        int sign = giacrs_dlu(a.data(), n, piv, &singular);
+        if (singular) {
+            *res = 0.0;
+        } else {
+            double d = (double)sign;
+            for (size_t k = 0; k < n; k++) {
+                d *= a[k * n + k];
+            }
+            *res = d;
+        }
+    })
+}
+
+extern "C" result giacrs_dmat_lu_solve(const double *data, const double *b,
+                                       size_t n, size_t nrhs, double *x) {
+    // Solves A X = B for X, B and X being n*nrhs row-major
+    SAFE_VOID_CALL({
+        std::vector<double> a(data, data + n * n);
+        std::vector<size_t> piv;
+        bool singular;
+        giacrs_dlu(a.data(), n, piv, &singular);
+        if (singular) {
+            throw std::runtime_error("Matrix is singular");
+        }
+        std::memcpy(x, b, n * nrhs * sizeof(double));
+        // apply the row permutation to the right-hand sides
+        for (size_t k = 0; k < n; k++) {
+            if (piv[k] != k) {
+                for (size_t j = 0; j < nrhs; j++) {
+                    std::swap(x[k * nrhs + j], x[piv[k] * nrhs + j]);
+                }
+            }
+        }
+        // forward substitution with unit-diagonal L
+        for (size_t i = 1; i < n; i++) {
+            for (size_t k = 0; k < i; k++) {
+                double f = a[i * n + k];
+                for (size_t j = 0; j < nrhs; j++) {
+                    x[i * nrhs + j] -= f * x[k * nrhs + j];
+                }
+            }
+        }
+        // back substitution with U
+        for (size_t i = n; i-- > 0;) {
+            for (size_t k = i + 1; k < n; k++) {
+                double f = a[i * n + k];
+                for (size_t j = 0; j < nrhs; j++) {
+                    x[i * nrhs + j] -= f * x[k * nrhs + j];
+                }
+            }
+            double d = a[i * n + i];
+            for (size_t j = 0; j < nrhs; j++) {
+                x[i * nrhs + j] /= d;
+            }
+        }
+    })
+}
+
+extern "C" void giacrs_dmat_mul(const double *a, const double *b, double *c,
+                                size_t m, size_t k, size_t n) {
+    // c (m*n) = a (m*k) * b (k*n), all row-major. The i-k-j loop order keeps
+    // the inner loop walking both b and c contiguously.
+    std::memset(c, 0, m * n * sizeof(double));
+    for (size_t i = 0; i < m; i++) {
+        for (size_t l = 0; l < k; l++) {
+            double f = a[i * k + l];
+            if (f == 0.0) {
+                continue;
+            }
+            for (size_t j = 0; j < n; j++) {
+                c[i * n + j] += f * b[l * n + j];
+            }
+        }
+    }
+}
+
+extern "C" size_t giacrs_dmat_rank(const double *data, size_t rows,
+                                   size_t cols) {
+    std::vector<double> a(data, data + rows * cols);
+    // scale-aware tolerance, as an exact zero test is meaningless after
+    // floating-point elimination
+    double maxabs = 0.0;
+    for (size_t i = 0; i < rows * cols; i++) {
+        double v = std::fabs(a[i]);
+        if (v > maxabs) {
+            maxabs = v;
+        }
+    }
+    double tol = maxabs * (double)(rows > cols ? rows : cols) * 2.220446049250313e-16;
+    size_t rank = 0;
+    for (size_t col = 0; col < cols && rank < rows; col++) {
+        size_t p = rank;
+        double best = std::fabs(a[rank * cols + col]);
+        for (size_t i = rank + 1; i < rows; i++) {
+            double v = std::fabs(a[i * cols + col]);
+            if (v > best) {
+                best = v;
+                p = i;
+            }
+        }
+        if (best <= tol) {
+            continue;
+        }
+        if (p != rank) {
+            for (size_t j = 0; j < cols; j++) {
+                std::swap(a[rank * cols + j], a[p * cols + j]);
+            }
+        }
+        double pivot = a[rank * cols + col];
+        for (size_t i = rank + 1; i < rows; i++) {
+            double f = a[i * cols + col] / pivot;
+            for (size_t j = col; j < cols; j++) {
+                a[i * cols + j] -= f * a[rank * cols + j];
+            }
+        }
+        rank++;
+    }
+    return rank;
+}
@@ -0,0 +1,2 @@
+#include "utils.hpp"
+#include <cstddef>
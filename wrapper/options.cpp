@@ -5,3 +5,29 @@ extern "C" void giacrs_options_set_epsilon(double e,
                                              const giac::context *ctx) {
     giac::epsilon(e, ctx);
 }
+
+// giac keeps its thread count and recursion limit as process-wide globals,
+// not context state, so those setters are necessarily global too.
+
+extern "C" void giacrs_options_set_threads(int n) {
+    giac::threads = n < 1 ? 1 : n;
+}
+
+extern "C" int giacrs_options_threads() { return giac::threads; }
+
+extern "C" void giacrs_options_set_proba_epsilon(double e,
+                                                 const giac::context *ctx) {
+    giac::proba_epsilon(ctx) = e;
+}
+
+extern "C" double giacrs_options_proba_epsilon(const giac::context *ctx) {
+    return giac::proba_epsilon(ctx);
+}
+
+extern "C" void giacrs_options_set_max_recursion(int n) {
+    giac::MAX_RECURSION_LEVEL = n;
+}
+
+extern "C" int giacrs_options_max_recursion() {
+    return giac::MAX_RECURSION_LEVEL;
+}
@@ -0,0 +1,50 @@
+#include "parallel.hpp"
+#include "context.hpp"
+#include "utils.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// Factors a batch of integers concurrently. Results are written back in
+// order. Each worker owns a private context (checked out from the context
+// pool) since contexts are not safe for concurrent use. Work is handed out
+// through an atomic cursor, so a hard semiprime only stalls the worker
+// holding it while the others drain the rest of the batch.
+extern "C" void giacrs_gen_ifactors_batch(giac::gen **xs, giac::gen **res,
+                                          result *statuses, size_t len,
+                                          size_t threads) {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+        if (threads == 0) {
+            threads = 1;
+        }
+    }
+    if (threads > len) {
+        threads = len == 0 ? 1 : len;
+    }
+    std::atomic<size_t> next(0);
+    auto worker = [&]() {
+        const giac::context *ctx = giacrs_context_checkout();
+        size_t i;
+        while ((i = next.fetch_add(1)) < len) {
+            try {
+                *res[i] = giac::_ifactors(*xs[i], ctx);
+                statuses[i] = NULL;
+            } catch (std::runtime_error &e) {
+                statuses[i] = string_to_c(e.what());
+            }
+        }
+        giacrs_context_release(ctx);
+    };
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < threads; t++) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (size_t t = 0; t < pool.size(); t++) {
+        pool[t].join();
+    }
+}
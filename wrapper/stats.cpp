@@ -0,0 +1,37 @@
+#include "stats.hpp"
+
+std::atomic<uint64_t> giacrs_stat_gens_allocated(0);
+std::atomic<uint64_t> giacrs_stat_gens_freed(0);
+std::atomic<uint64_t> giacrs_stat_gens_peak(0);
+std::atomic<uint64_t> giacrs_stat_strings_allocated(0);
+std::atomic<uint64_t> giacrs_stat_strings_freed(0);
+std::atomic<uint64_t> giacrs_stat_memo_hits(0);
+std::atomic<uint64_t> giacrs_stat_memo_misses(0);
+
+void giacrs_stat_gen_allocated() {
+    uint64_t live =
+        giacrs_stat_gens_allocated.fetch_add(1, std::memory_order_relaxed) +
+        1 - giacrs_stat_gens_freed.load(std::memory_order_relaxed);
+    uint64_t peak = giacrs_stat_gens_peak.load(std::memory_order_relaxed);
+    while (live > peak &&
+           !giacrs_stat_gens_peak.compare_exchange_weak(
+               peak, live, std::memory_order_relaxed)) {
+    }
+}
+
+void giacrs_stat_gen_freed() {
+    giacrs_stat_gens_freed.fetch_add(1, std::memory_order_relaxed);
+}
+
+extern "C" void giacrs_stats_snapshot(giacrs_stats *out) {
+    out->gens_allocated =
+        giacrs_stat_gens_allocated.load(std::memory_order_relaxed);
+    out->gens_freed = giacrs_stat_gens_freed.load(std::memory_order_relaxed);
+    out->gens_peak = giacrs_stat_gens_peak.load(std::memory_order_relaxed);
+    out->strings_allocated =
+        giacrs_stat_strings_allocated.load(std::memory_order_relaxed);
+    out->strings_freed =
+        giacrs_stat_strings_freed.load(std::memory_order_relaxed);
+    out->memo_hits = giacrs_stat_memo_hits.load(std::memory_order_relaxed);
+    out->memo_misses = giacrs_stat_memo_misses.load(std::memory_order_relaxed);
+}
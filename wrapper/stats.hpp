@@ -0,0 +1,27 @@
+#include <atomic>
+#include <cstdint>
+
+// Global allocation counters for capacity planning and leak hunting in
+// long-lived services. Bumped with relaxed atomics so the hot paths only pay
+// an uncontended increment. Snapshot them with giacrs_stats_snapshot.
+extern std::atomic<uint64_t> giacrs_stat_gens_allocated;
+extern std::atomic<uint64_t> giacrs_stat_gens_freed;
+extern std::atomic<uint64_t> giacrs_stat_gens_peak;
+extern std::atomic<uint64_t> giacrs_stat_strings_allocated;
+extern std::atomic<uint64_t> giacrs_stat_strings_freed;
+extern std::atomic<uint64_t> giacrs_stat_memo_hits;
+extern std::atomic<uint64_t> giacrs_stat_memo_misses;
+
+// Field order is part of the FFI contract with src/stats.rs
+struct giacrs_stats {
+    uint64_t gens_allocated;
+    uint64_t gens_freed;
+    uint64_t gens_peak;
+    uint64_t strings_allocated;
+    uint64_t strings_freed;
+    uint64_t memo_hits;
+    uint64_t memo_misses;
+};
+
+void giacrs_stat_gen_allocated();
+void giacrs_stat_gen_freed();
@@ -1,4 +1,30 @@
+#include "stats.hpp"
 #include "utils.hpp"
 #include <cstdlib>
 
-extern "C" void giacrs_free_str(char *s) { free(s); }
+extern "C" void giacrs_free_str(char *s) {
+    giacrs_stat_strings_freed.fetch_add(1, std::memory_order_relaxed);
+    free(s);
+}
+
+// Thread-local error slot for the errcode-returning entry points. The buffer
+// is reused across failures on the same thread, so the error path does not
+// allocate until the caller explicitly asks for a malloc'd copy.
+static thread_local std::string giacrs_last_error;
+
+void giacrs_store_error(const char *msg) { giacrs_last_error = msg; }
+
+extern "C" size_t giacrs_last_error_length() {
+    return giacrs_last_error.length();
+}
+
+// Borrowed pointer, only valid until the next failing call on this thread
+extern "C" const char *giacrs_last_error_message() {
+    return giacrs_last_error.c_str();
+}
+
+// Malloc'd copy for callers who need to keep the message; free it with
+// giacrs_free_str
+extern "C" char *giacrs_last_error_copy() {
+    return string_to_c(giacrs_last_error);
+}
@@ -1,4 +1,6 @@
+#include <cstdint>
 #include <ostream>
+#include <string>
 
 #define SAFE_VOID_CALL(res_code)                                               \
     try {                                                                      \
@@ -14,6 +16,27 @@
 
 typedef const char *result;
 
+// Errcode convention: 0 on success, non-zero on failure. The exception
+// message goes into a thread-local slot (see utils.cpp) instead of being
+// malloc'd on every failure like the `result` convention does; callers
+// fetch it with giacrs_last_error_* only when they want the text.
+typedef int32_t errcode;
+
+void giacrs_store_error(const char *msg);
+
+#define SAFE_VOID_CALL_CODE(res_code)                                          \
+    try {                                                                      \
+        res_code return 0;                                                     \
+    } catch (std::runtime_error & e) {                                         \
+        giacrs_store_error(e.what());                                          \
+        return 1;                                                              \
+    }
+
+#define SAFE_CALL_CODE(res_code) SAFE_VOID_CALL_CODE(*res = res_code;)
+
+// Defined in gen.cpp, copies a std::string into a malloc'd C string
+char *string_to_c(std::string s);
+
 // This is a stream which does not output anything
 class NullStream : public std::ostream {
     // streambuffer doing nothing
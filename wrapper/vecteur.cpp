@@ -0,0 +1,79 @@
+#include "vecteur.hpp"
+#include "stats.hpp"
+#include "utils.hpp"
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+// Bulk construction of vecteurs/matrices from contiguous native buffers, so
+// feeding numeric data into giac is a single linear pass instead of a parse
+// of a formatted string or one FFI call per element.
+
+extern "C" giac::gen *giacrs_gen_vecteur_from_doubles(const double *data,
+                                                      size_t len) {
+    giacrs_stat_gen_allocated();
+    giac::vecteur v(len);
+    for (size_t i = 0; i < len; i++) {
+        v[i] = giac::gen(data[i]);
+    }
+    return new giac::gen(v);
+}
+
+extern "C" giac::gen *giacrs_gen_vecteur_from_ints(const int64_t *data,
+                                                   size_t len) {
+    giacrs_stat_gen_allocated();
+    giac::vecteur v(len);
+    for (size_t i = 0; i < len; i++) {
+        v[i] = giac::gen((long long)data[i]);
+    }
+    return new giac::gen(v);
+}
+
+extern "C" giac::gen *giacrs_gen_matrix_from_doubles(const double *data,
+                                                     size_t rows,
+                                                     size_t cols) {
+    // data is row-major, rows*cols elements
+    giacrs_stat_gen_allocated();
+    giac::vecteur m(rows);
+    for (size_t r = 0; r < rows; r++) {
+        giac::vecteur row(cols);
+        for (size_t c = 0; c < cols; c++) {
+            row[c] = giac::gen(data[r * cols + c]);
+        }
+        m[r] = giac::gen(row);
+    }
+    return new giac::gen(m);
+}
+
+extern "C" result giacrs_gen_vecteur_len(giac::gen *e, size_t *res) {
+    SAFE_VOID_CALL({
+        if (e->type != giac::_VECT) {
+            throw std::runtime_error("Expression is not a vector");
+        }
+        *res = e->_VECTptr->size();
+    })
+}
+
+extern "C" result giacrs_gen_vecteur_to_doubles(giac::gen *e, double *out,
+                                                size_t len) {
+    SAFE_VOID_CALL({
+        if (e->type != giac::_VECT) {
+            throw std::runtime_error("Expression is not a vector");
+        }
+        const giac::vecteur &v = *e->_VECTptr;
+        if (v.size() != len) {
+            throw std::runtime_error("Vector length mismatch");
+        }
+        for (size_t i = 0; i < len; i++) {
+            const giac::gen &g = v[i];
+            if (g.type == giac::_DOUBLE_) {
+                out[i] = g._DOUBLE_val;
+            } else if (g.type == giac::_INT_) {
+                out[i] = (double)g.val;
+            } else {
+                throw std::runtime_error("Vector element is not numeric");
+            }
+        }
+    })
+}